@@ -0,0 +1,85 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/master/LICENSE.
+
+// Measures saving and loading vectors of integers and floating point numbers
+// with 1K to 10M elements and compares the bulk overloads of the binary
+// serializer and deserializer to processing each element on its own.
+
+#include "caf/binary_serializer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+#include "caf/binary_deserializer.hpp"
+#include "caf/byte_buffer.hpp"
+
+using namespace caf;
+
+namespace {
+
+template <class F>
+double measure(size_t runs, F f) {
+  auto t0 = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < runs; ++i)
+    f();
+  auto t1 = std::chrono::steady_clock::now();
+  std::chrono::duration<double, std::micro> elapsed = t1 - t0;
+  return elapsed.count() / static_cast<double>(runs);
+}
+
+void check(bool ok) {
+  if (!ok) {
+    std::cerr << "\nfailed to serialize or deserialize\n";
+    std::exit(EXIT_FAILURE);
+  }
+}
+
+template <class T>
+void run(const char* type_name, size_t n) {
+  // Keep the total amount of work roughly constant across all sizes.
+  auto runs = std::max(size_t{1}, size_t{10'000'000} / n);
+  std::vector<T> xs(n);
+  std::iota(xs.begin(), xs.end(), T{1});
+  byte_buffer buf;
+  auto save_bulk = measure(runs, [&] {
+    buf.clear();
+    binary_serializer sink{nullptr, buf};
+    check(sink.apply(xs));
+  });
+  auto save_each = measure(runs, [&] {
+    buf.clear();
+    binary_serializer sink{nullptr, buf};
+    check(static_cast<binary_serializer::super&>(sink).list(xs));
+  });
+  std::vector<T> ys;
+  auto load_bulk = measure(runs, [&] {
+    binary_deserializer source{nullptr, buf};
+    check(source.apply(ys));
+  });
+  auto load_each = measure(runs, [&] {
+    binary_deserializer source{nullptr, buf};
+    check(static_cast<binary_deserializer::super&>(source).list(ys));
+  });
+  check(xs == ys);
+  std::cout << type_name << ", " << n << " elements: save " << save_bulk
+            << "us (bulk) vs. " << save_each << "us (each), load "
+            << load_bulk << "us (bulk) vs. " << load_each << "us (each)\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  size_t max_elements = 10'000'000;
+  if (argc > 1)
+    max_elements = static_cast<size_t>(std::atoll(argv[1]));
+  for (size_t n = 1'000; n <= max_elements; n *= 10)
+    run<int32_t>("int32_t", n);
+  for (size_t n = 1'000; n <= max_elements; n *= 10)
+    run<double>("double", n);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,119 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/master/LICENSE.
+
+// Measures the enqueue throughput of lifo_inbox with several producers and
+// compares it to the previous layout without padding. The difference only
+// shows on machines with several cores.
+
+#include "caf/intrusive/lifo_inbox.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "caf/intrusive/singly_linked.hpp"
+
+using namespace caf;
+using namespace caf::intrusive;
+
+namespace {
+
+struct inode : singly_linked<inode> {
+  int value;
+  inode(int x = 0) : value(x) {
+    // nop
+  }
+};
+
+struct inode_policy {
+  using mapped_type = inode;
+
+  using task_size_type = int;
+
+  using deficit_type = int;
+
+  using deleter_type = std::default_delete<mapped_type>;
+
+  using unique_pointer = std::unique_ptr<mapped_type, deleter_type>;
+};
+
+using padded_inbox = lifo_inbox<inode_policy>;
+
+// Replicates the previous layout of `lifo_inbox` without padding.
+struct unpadded_inbox {
+  std::atomic<inode*> stack{nullptr};
+
+  void emplace_front(int x) {
+    auto ptr = new inode(x);
+    auto e = stack.load();
+    do {
+      ptr->next = e;
+    } while (!stack.compare_exchange_weak(e, ptr));
+  }
+
+  inode* take_head() {
+    return stack.exchange(nullptr);
+  }
+};
+
+// Mimics an actor that updates its own state right next to its mailbox while
+// processing messages.
+template <class Inbox>
+struct actor_like {
+  Inbox inbox;
+  std::atomic<size_t> owner_state{0};
+};
+
+// Runs `num_producers` threads that push `num_items` each into the inbox while
+// the calling thread consumes all items. Returns the elapsed time in seconds.
+template <class Inbox>
+double run_producers(size_t num_producers, size_t num_items) {
+  auto self = std::make_unique<actor_like<Inbox>>();
+  auto t0 = std::chrono::steady_clock::now();
+  std::vector<std::thread> producers;
+  for (size_t i = 0; i < num_producers; ++i)
+    producers.emplace_back([&self, num_items] {
+      for (size_t j = 0; j < num_items; ++j)
+        self->inbox.emplace_front(static_cast<int>(j));
+    });
+  auto total = num_producers * num_items;
+  size_t consumed = 0;
+  while (consumed < total) {
+    auto ptr = self->inbox.take_head();
+    while (ptr != nullptr) {
+      auto next = static_cast<inode*>(ptr->next);
+      auto state = self->owner_state.load(std::memory_order_relaxed);
+      self->owner_state.store(state + 1, std::memory_order_relaxed);
+      delete ptr;
+      ptr = next;
+      ++consumed;
+    }
+  }
+  for (auto& t : producers)
+    t.join();
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - t0;
+  return elapsed.count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  size_t num_producers = 4;
+  size_t num_items = 1'000'000;
+  if (argc > 1)
+    num_producers = static_cast<size_t>(std::atoll(argv[1]));
+  if (argc > 2)
+    num_items = static_cast<size_t>(std::atoll(argv[2]));
+  auto total = static_cast<double>(num_producers * num_items);
+  auto before = run_producers<unpadded_inbox>(num_producers, num_items);
+  auto after = run_producers<padded_inbox>(num_producers, num_items);
+  std::cout << num_producers << " producers, " << num_items << " items each\n"
+            << "without padding: " << total / before << " items/s\n"
+            << "with padding:    " << total / after << " items/s\n";
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,80 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/master/LICENSE.
+
+// Measures inserting and removing handlers for multiplexed responses with up
+// to one million outstanding requests and compares the response handler table
+// to the previous flat map. The flat map has linear lookups, so we only run it
+// for up to 10,000 requests by default.
+
+#include "caf/detail/response_handler_table.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+#include "caf/behavior.hpp"
+#include "caf/detail/unordered_flat_map.hpp"
+#include "caf/message_id.hpp"
+
+using namespace caf;
+
+namespace {
+
+message_id response_id(uint64_t x) {
+  return make_message_id(x).response_id();
+}
+
+// Responses arrive in a different order than the requests.
+message_id nth_response(uint64_t i, uint64_t n) {
+  return response_id(1 + (i * 7) % n);
+}
+
+template <class F>
+long long measure(F f) {
+  auto t0 = std::chrono::steady_clock::now();
+  f();
+  auto t1 = std::chrono::steady_clock::now();
+  using std::chrono::duration_cast;
+  using std::chrono::milliseconds;
+  return duration_cast<milliseconds>(t1 - t0).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  uint64_t max_flat_map_requests = 10'000;
+  if (argc > 1)
+    max_flat_map_requests = static_cast<uint64_t>(std::atoll(argv[1]));
+  behavior handler{[](int32_t) {}};
+  for (uint64_t n = 10; n <= 1'000'000; n *= 10) {
+    std::cout << n << " requests: ";
+    detail::response_handler_table table;
+    std::cout << measure([&] {
+      for (uint64_t i = 1; i <= n; ++i)
+        table.emplace(response_id(i), handler);
+      for (uint64_t i = 0; i < n; ++i) {
+        behavior bhvr;
+        table.take(nth_response(i, n), bhvr);
+      }
+    }) << "ms (table)";
+    if (!table.empty()) {
+      std::cerr << "\ntable: unexpected number of handlers\n";
+      return EXIT_FAILURE;
+    }
+    if (n <= max_flat_map_requests) {
+      detail::unordered_flat_map<message_id, behavior> flat_map;
+      std::cout << ", " << measure([&] {
+        for (uint64_t i = 1; i <= n; ++i)
+          flat_map.emplace(response_id(i), handler);
+        for (uint64_t i = 0; i < n; ++i) {
+          auto j = flat_map.find(nth_response(i, n));
+          auto bhvr = std::move(j->second);
+          flat_map.erase(j);
+        }
+      }) << "ms (flat map)";
+    }
+    std::cout << '\n';
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,90 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/master/LICENSE.
+
+// Measures how many short-lived actors CAF spawns and terminates per second,
+// with and without recycling the memory of the actors.
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "caf/actor_system.hpp"
+#include "caf/actor_system_config.hpp"
+#include "caf/detail/memory_pool.hpp"
+#include "caf/event_based_actor.hpp"
+#include "caf/init_global_meta_objects.hpp"
+#include "caf/stateful_actor.hpp"
+
+using namespace caf;
+
+namespace {
+
+struct session_state {
+  std::string user;
+  size_t requests = 0;
+};
+
+// Terminates immediately after initialization, since it has no behavior.
+void short_lived(event_based_actor*) {
+  // nop
+}
+
+void stateful_short_lived(stateful_actor<session_state>* self) {
+  self->state.user = "anonymous";
+}
+
+// Keeps `batch_size` actors alive at a time and spawns a new actor whenever one
+// of them terminates, i.e., most actors reuse the memory of a previous one.
+template <class F>
+void run(const char* name, size_t num_actors, F fun) {
+  constexpr size_t batch_size = 100;
+  actor_system_config cfg;
+  actor_system sys{cfg};
+  auto t0 = std::chrono::steady_clock::now();
+  // Holding the handle keeps the driver reachable until it calls `quit`.
+  auto driver = sys.spawn([num_actors, fun](event_based_actor* self) {
+    auto spawned = std::make_shared<size_t>(0);
+    auto terminated = std::make_shared<size_t>(0);
+    auto spawn_next = [self, fun, num_actors, spawned] {
+      if (*spawned < num_actors) {
+        ++*spawned;
+        self->spawn<monitored>(fun);
+      }
+    };
+    self->set_down_handler([=](down_msg&) {
+      if (++*terminated == num_actors)
+        self->quit();
+      else
+        spawn_next();
+    });
+    for (size_t i = 0; i < batch_size; ++i)
+      spawn_next();
+    return behavior{
+      [](int32_t) {
+        // nop
+      },
+    };
+  });
+  sys.await_all_actors_done();
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - t0;
+  std::cout << name << ": " << num_actors / elapsed.count() << " actors/s\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  core::init_global_meta_objects();
+  size_t num_actors = 200'000;
+  if (argc > 1)
+    num_actors = static_cast<size_t>(std::atoll(argv[1]));
+  for (auto enable : {false, true}) {
+    detail::memory_pool::enable(enable);
+    std::cout << "memory pool " << (enable ? "enabled" : "disabled") << '\n';
+    run("  event_based_actor", num_actors, short_lived);
+    run("  stateful_actor", num_actors, stateful_short_lived);
+  }
+  return EXIT_SUCCESS;
+}
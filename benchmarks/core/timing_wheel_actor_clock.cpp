@@ -0,0 +1,104 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/master/LICENSE.
+
+// Compares the timing wheel to the simple actor clock with many pending
+// request timeouts, spread over 1000 actors and one hour.
+
+#include "caf/detail/timing_wheel_actor_clock.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "caf/actor_system.hpp"
+#include "caf/actor_system_config.hpp"
+#include "caf/detail/simple_actor_clock.hpp"
+#include "caf/event_based_actor.hpp"
+#include "caf/init_global_meta_objects.hpp"
+#include "caf/send.hpp"
+
+using namespace caf;
+
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr size_t num_actors = 1'000;
+
+constexpr uint64_t cancel_stride = 100;
+
+behavior testee() {
+  return {
+    [](const std::string&) {
+      // nop
+    },
+  };
+}
+
+message_id request_id(uint64_t x) {
+  return make_message_id(x).response_id();
+}
+
+template <class Clock, class Size>
+void run(const char* name, Clock& clk, Size size,
+         const std::vector<abstract_actor*>& ptrs, uint64_t num_timers) {
+  using std::chrono::steady_clock;
+  auto t0 = steady_clock::now();
+  auto base = clk.now() + 1s;
+  for (uint64_t i = 0; i < num_timers; ++i)
+    clk.set_request_timeout(base + i * 3600us, ptrs[i % num_actors],
+                            request_id(i));
+  auto t1 = steady_clock::now();
+  auto scheduled = size(clk);
+  for (uint64_t i = 0; i < num_timers; i += cancel_stride)
+    clk.cancel_request_timeout(ptrs[i % num_actors], request_id(i));
+  auto t2 = steady_clock::now();
+  for (auto ptr : ptrs)
+    clk.cancel_timeouts(ptr);
+  auto t3 = steady_clock::now();
+  if (scheduled != num_timers || size(clk) != 0) {
+    std::cerr << name << ": unexpected number of pending timers\n";
+    std::exit(EXIT_FAILURE);
+  }
+  auto ms = [](auto x) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(x).count();
+  };
+  std::cout << name << ": schedule " << num_timers << " timers in "
+            << ms(t1 - t0) << "ms, cancel " << num_timers / cancel_stride
+            << " timers in " << ms(t2 - t1) << "ms, cancel the rest in "
+            << ms(t3 - t2) << "ms\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  core::init_global_meta_objects();
+  uint64_t num_timers = 1'000'000;
+  if (argc > 1)
+    num_timers = static_cast<uint64_t>(std::atoll(argv[1]));
+  actor_system_config cfg;
+  actor_system sys{cfg};
+  std::vector<actor> actors;
+  std::vector<abstract_actor*> ptrs;
+  for (size_t i = 0; i < num_actors; ++i) {
+    actors.emplace_back(sys.spawn(testee));
+    ptrs.emplace_back(actor_cast<abstract_actor*>(actors.back()));
+  }
+  {
+    detail::simple_actor_clock clk;
+    run(
+      "simple_actor_clock", clk, [](auto& x) { return x.schedule().size(); },
+      ptrs, num_timers);
+  }
+  {
+    detail::timing_wheel_actor_clock clk;
+    run(
+      "timing_wheel_actor_clock", clk, [](auto& x) { return x.size(); }, ptrs,
+      num_timers);
+  }
+  for (auto& hdl : actors)
+    anon_send_exit(hdl, exit_reason::user_shutdown);
+  return EXIT_SUCCESS;
+}
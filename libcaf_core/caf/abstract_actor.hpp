@@ -59,6 +59,18 @@ public:
   /// This `enqueue` variant allows to define forwarding chains.
   virtual void enqueue(mailbox_element_ptr what, execution_unit* host) = 0;
 
+  /// Enqueues a chain of mailbox elements to the actor. The elements are
+  /// linked via `next` in the order the actor shall receive them and the last
+  /// element has no successor. Actors with a lock-free mailbox append the
+  /// entire chain at once and get scheduled at most once. The default
+  /// implementation calls `enqueue` for each element.
+  virtual void enqueue_batch(mailbox_element_ptr first, execution_unit* host);
+
+  /// Queries whether the mailbox of this actor reached its capacity. Senders
+  /// may use this signal to back off before sending more messages. Always
+  /// returns `false` for actors without a bounded mailbox.
+  virtual bool mailbox_congested() const noexcept;
+
   /// Attaches `ptr` to this actor. The actor will call `ptr->detach(...)` on
   /// exit, or immediately if it already finished execution.
   virtual void attach(attachable_ptr ptr) = 0;
@@ -111,18 +123,19 @@ public:
   }
 
   // flags storing runtime information                      used by ...
-  static constexpr int has_timeout_flag = 0x0004;      // single_timeout
-  static constexpr int is_registered_flag = 0x0008;    // (several actors)
-  static constexpr int is_initialized_flag = 0x0010;   // event-based actors
-  static constexpr int is_blocking_flag = 0x0020;      // blocking_actor
-  static constexpr int is_detached_flag = 0x0040;      // local_actor
-  static constexpr int collects_metrics_flag = 0x0080; // local_actor
-  static constexpr int is_serializable_flag = 0x0100;  // local_actor
-  static constexpr int is_migrated_from_flag = 0x0200; // local_actor
-  static constexpr int has_used_aout_flag = 0x0400;    // local_actor
-  static constexpr int is_terminated_flag = 0x0800;    // local_actor
-  static constexpr int is_cleaned_up_flag = 0x1000;    // monitorable_actor
-  static constexpr int is_shutting_down_flag = 0x2000; // scheduled_actor
+  static constexpr int has_timeout_flag = 0x0004;       // single_timeout
+  static constexpr int is_registered_flag = 0x0008;     // (several actors)
+  static constexpr int is_initialized_flag = 0x0010;    // event-based actors
+  static constexpr int is_blocking_flag = 0x0020;       // blocking_actor
+  static constexpr int is_detached_flag = 0x0040;       // local_actor
+  static constexpr int collects_metrics_flag = 0x0080;  // local_actor
+  static constexpr int is_serializable_flag = 0x0100;   // local_actor
+  static constexpr int is_migrated_from_flag = 0x0200;  // local_actor
+  static constexpr int has_used_aout_flag = 0x0400;     // local_actor
+  static constexpr int is_terminated_flag = 0x0800;     // local_actor
+  static constexpr int is_cleaned_up_flag = 0x1000;     // monitorable_actor
+  static constexpr int is_shutting_down_flag = 0x2000;  // scheduled_actor
+  static constexpr int has_worker_timers_flag = 0x4000; // local_actor
 
   void setf(int flag) {
     auto x = flags();
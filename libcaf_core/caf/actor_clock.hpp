@@ -6,6 +6,7 @@
 
 #include <chrono>
 #include <string>
+#include <vector>
 
 #include "caf/detail/core_export.hpp"
 #include "caf/fwd.hpp"
@@ -51,6 +52,16 @@ public:
   set_request_timeout(time_point t, abstract_actor* self, message_id id)
     = 0;
 
+  /// Schedules a `sec::request_timeout` for each ID in `ids` at time point
+  /// `t`. Clocks may store all IDs in a single entry that callers cancel by
+  /// passing the first ID to `cancel_request_timeout`. The default
+  /// implementation calls `set_request_timeout` for each ID instead. Cancelling
+  /// the first ID then leaves the other timeouts in place, which is harmless
+  /// since actors discard timeouts for requests without a pending handler.
+  /// @pre `!ids.empty()`
+  virtual void set_request_group_timeout(time_point t, abstract_actor* self,
+                                         std::vector<message_id> ids);
+
   /// Cancels a pending receive timeout.
   virtual void cancel_ordinary_timeout(abstract_actor* self, std::string type)
     = 0;
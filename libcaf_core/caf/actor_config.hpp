@@ -12,6 +12,7 @@
 #include "caf/detail/unique_function.hpp"
 #include "caf/fwd.hpp"
 #include "caf/input_range.hpp"
+#include "caf/mailbox_overflow_policy.hpp"
 
 namespace caf {
 
@@ -35,12 +36,29 @@ public:
   input_range<const group>* groups;
   detail::unique_function<behavior(local_actor*)> init_fun;
 
+  /// Maximum number of asynchronous messages in the mailbox of the actor. The
+  /// default value 0 means unbounded.
+  size_t mailbox_capacity;
+
+  /// Configures how the actor handles messages that exceed its
+  /// `mailbox_capacity`.
+  mailbox_overflow_policy overflow_policy;
+
   // -- properties -------------------------------------------------------------
 
   actor_config& add_flag(int x) {
     flags |= x;
     return *this;
   }
+
+  /// Bounds the mailbox of the actor to `capacity` asynchronous messages.
+  actor_config& bound_mailbox(size_t capacity,
+                              mailbox_overflow_policy policy
+                              = mailbox_overflow_policy::drop_newest) {
+    mailbox_capacity = capacity;
+    overflow_policy = policy;
+    return *this;
+  }
 };
 
 /// @relates actor_config
@@ -120,6 +120,8 @@ public:
 
   void enqueue(mailbox_element_ptr what, execution_unit* host);
 
+  void enqueue_batch(mailbox_element_ptr first, execution_unit* host);
+
   /// @endcond
 };
 
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <condition_variable>
 #include <cstdint>
@@ -16,6 +17,7 @@
 #include "caf/actor.hpp"
 #include "caf/actor_cast.hpp"
 #include "caf/actor_control_block.hpp"
+#include "caf/config.hpp"
 #include "caf/detail/core_export.hpp"
 #include "caf/detail/shared_spinlock.hpp"
 #include "caf/fwd.hpp"
@@ -29,10 +31,17 @@ namespace caf {
 /// independent from their ID at runtime. Note that the registry does *not*
 /// contain all actors of an actor system. The middleman registers actors as
 /// needed.
+///
+/// The registry splits the mapping from IDs to actors into shards with a lock
+/// of their own. Lookups and updates only lock the shard for the actor ID, so
+/// threads accessing different actors rarely contend.
 class CAF_CORE_EXPORT actor_registry {
 public:
   friend class actor_system;
 
+  /// Number of shards for the mapping from IDs to actors.
+  static constexpr size_t num_shards = 16;
+
   ~actor_registry();
 
   /// Returns the local actor associated to `key`.
@@ -108,13 +117,33 @@ private:
 
   using entries = std::unordered_map<actor_id, strong_actor_ptr>;
 
+  /// Stores a portion of the mapping from IDs to actors. Each shard starts at
+  /// a cache line of its own to avoid false sharing between the locks.
+  struct alignas(CAF_CACHE_LINE_SIZE) shard {
+    mutable detail::shared_spinlock mtx;
+    entries map;
+  };
+
+  static_assert((num_shards & (num_shards - 1)) == 0,
+                "num_shards must be a power of two");
+
   actor_registry(actor_system& sys);
 
+  /// Returns the shard for `key`. Since actor IDs are consecutive, the lowest
+  /// bits spread the actors evenly across all shards.
+  shard& shard_of(actor_id key) noexcept {
+    return shards_[key & (num_shards - 1)];
+  }
+
+  /// @copydoc shard_of
+  const shard& shard_of(actor_id key) const noexcept {
+    return shards_[key & (num_shards - 1)];
+  }
+
   mutable std::mutex running_mtx_;
   mutable std::condition_variable running_cv_;
 
-  mutable detail::shared_spinlock instances_mtx_;
-  entries entries_;
+  std::array<shard, num_shards> shards_;
 
   name_map named_entries_;
   mutable detail::shared_spinlock named_entries_mtx_;
@@ -12,6 +12,7 @@
 #include "caf/abstract_actor.hpp"
 #include "caf/actor_control_block.hpp"
 #include "caf/config.hpp"
+#include "caf/detail/typed_memory_pool.hpp"
 
 #ifdef CAF_GCC
 #  pragma GCC diagnostic push
@@ -58,10 +59,25 @@ public:
   actor_storage(const actor_storage&) = delete;
   actor_storage& operator=(const actor_storage&) = delete;
 
+  // Recycle the memory of terminated actors while the memory pool is enabled.
+  // Actor storage is always over-aligned, i.e., `new` and `delete` call the
+  // overloads with an alignment argument.
+
+  static void* operator new(size_t, std::align_val_t) {
+    return detail::typed_memory_pool<actor_storage>::allocate();
+  }
+
+  static void operator delete(void* ptr, std::align_val_t) noexcept {
+    detail::typed_memory_pool<actor_storage>::deallocate(ptr);
+  }
+
   static_assert(sizeof(actor_control_block) < CAF_CACHE_LINE_SIZE,
                 "actor_control_block exceeds 64 bytes");
 
-  actor_control_block ctrl;
+  // Aligning the control block puts it on a cache line of its own. Otherwise,
+  // reference counting on other threads may interfere with the first fields
+  // of the actor or with unrelated objects in front of the storage.
+  alignas(CAF_CACHE_LINE_SIZE) actor_control_block ctrl;
   char pad[CAF_CACHE_LINE_SIZE - sizeof(actor_control_block)];
   union {
     T data;
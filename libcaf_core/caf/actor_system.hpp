@@ -194,6 +194,21 @@ public:
     /// Counts how many messages are currently waiting in the mailbox.
     telemetry::int_gauge_family* mailbox_size = nullptr;
 
+    /// Counts how many messages the actor discarded due to a full mailbox.
+    telemetry::int_counter_family* mailbox_drops = nullptr;
+
+    /// Counts how often the actor exceeded its time budget per run.
+    telemetry::int_counter_family* time_slice_overruns = nullptr;
+
+    /// Counts how many actors currently hibernate.
+    telemetry::int_gauge_family* hibernating_actors = nullptr;
+
+    /// Counts how many bytes hibernating actors use for their serialized state.
+    telemetry::int_gauge_family* hibernated_bytes = nullptr;
+
+    /// Samples how long actors need to restore their state after hibernating.
+    telemetry::dbl_histogram_family* wakeup_time = nullptr;
+
     struct {
       // -- inbound ------------------------------------------------------------
 
@@ -4,14 +4,17 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <string>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "caf/detail/core_export.hpp"
 #include "caf/detail/squashed_int.hpp"
+#include "caf/detail/type_traits.hpp"
 #include "caf/error_code.hpp"
 #include "caf/fwd.hpp"
 #include "caf/load_inspector_base.hpp"
@@ -198,8 +201,87 @@ public:
 
   bool value(span<byte> x) noexcept;
 
+  // -- bulk processing of arithmetic sequences --------------------------------
+
+  // Each overload reads the same bytes as calling `value` on each element but
+  // performs only a single range check.
+
+  bool value(span<int8_t> xs) noexcept;
+
+  bool value(span<uint8_t> xs) noexcept;
+
+  bool value(span<int16_t> xs) noexcept;
+
+  bool value(span<uint16_t> xs) noexcept;
+
+  bool value(span<int32_t> xs) noexcept;
+
+  bool value(span<uint32_t> xs) noexcept;
+
+  bool value(span<int64_t> xs) noexcept;
+
+  bool value(span<uint64_t> xs) noexcept;
+
+  bool value(span<float> xs) noexcept;
+
+  bool value(span<double> xs) noexcept;
+
+  using super::list;
+
+  /// Reads `xs` with a single call to `value` if possible.
+  template <class T>
+  bool list(std::vector<T>& xs) {
+    if constexpr (detail::is_bulk_inspectable_v<T>) {
+      xs.clear();
+      auto size = size_t{0};
+      if (!begin_sequence(size))
+        return false;
+      // Check the size before allocating memory for the elements.
+      if (size > remaining() / sizeof(T)) {
+        emplace_error(sec::end_of_stream);
+        return false;
+      }
+      xs.resize(size);
+      return value(make_span(xs)) && end_sequence();
+    } else {
+      return super::list(xs);
+    }
+  }
+
+  using super::tuple;
+
+  /// Reads `xs` with a single call to `value` if possible.
+  template <class T, size_t N>
+  bool tuple(std::array<T, N>& xs) {
+    if constexpr (detail::is_bulk_inspectable_v<T>)
+      return value(make_span(xs));
+    else
+      return super::tuple(xs);
+  }
+
+  /// Reads `xs` with a single call to `value` if possible.
+  template <class T, size_t N>
+  bool tuple(T (&xs)[N]) {
+    if constexpr (detail::is_bulk_inspectable_v<T>)
+      return value(make_span(xs));
+    else
+      return super::tuple(xs);
+  }
+
   bool value(std::vector<bool>& x);
 
+  // -- zero-copy access to the input ------------------------------------------
+
+  // Each overload reads the same bytes as the matching `value` overload for
+  // `std::string` or `std::vector<byte>` but points `x` into the input instead
+  // of copying. The result remains valid only as long as the input buffer.
+
+  /// Reads a string and points `x` to its characters in the input.
+  bool read_view(string_view& x) noexcept;
+
+  /// Reads a sequence of bytes and points `x` to its elements in the input.
+  bool read_view(span<const byte>& x) noexcept;
+
 private:
   explicit binary_deserializer(actor_system& sys) noexcept;
 
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <string>
 #include <type_traits>
@@ -13,6 +14,7 @@
 #include "caf/byte_buffer.hpp"
 #include "caf/detail/core_export.hpp"
 #include "caf/detail/squashed_int.hpp"
+#include "caf/detail/type_traits.hpp"
 #include "caf/fwd.hpp"
 #include "caf/save_inspector_base.hpp"
 #include "caf/span.hpp"
@@ -178,6 +180,63 @@ public:
 
   bool value(const std::vector<bool>& x);
 
+  // -- bulk processing of arithmetic sequences --------------------------------
+
+  // Each overload writes the same bytes as calling `value` on each element
+  // but resizes the buffer only once.
+
+  bool value(span<const int8_t> xs);
+
+  bool value(span<const uint8_t> xs);
+
+  bool value(span<const int16_t> xs);
+
+  bool value(span<const uint16_t> xs);
+
+  bool value(span<const int32_t> xs);
+
+  bool value(span<const uint32_t> xs);
+
+  bool value(span<const int64_t> xs);
+
+  bool value(span<const uint64_t> xs);
+
+  bool value(span<const float> xs);
+
+  bool value(span<const double> xs);
+
+  using super::list;
+
+  /// Writes `xs` with a single call to `value` if possible.
+  template <class T>
+  bool list(const std::vector<T>& xs) {
+    if constexpr (detail::is_bulk_inspectable_v<T>)
+      return begin_sequence(xs.size()) && value(make_span(xs))
+             && end_sequence();
+    else
+      return super::list(xs);
+  }
+
+  using super::tuple;
+
+  /// Writes `xs` with a single call to `value` if possible.
+  template <class T, size_t N>
+  bool tuple(const std::array<T, N>& xs) {
+    if constexpr (detail::is_bulk_inspectable_v<T>)
+      return value(make_span(xs));
+    else
+      return super::tuple(xs);
+  }
+
+  /// Writes `xs` with a single call to `value` if possible.
+  template <class T, size_t N>
+  bool tuple(T (&xs)[N]) {
+    if constexpr (detail::is_bulk_inspectable_v<std::remove_const_t<T>>)
+      return value(make_span(static_cast<const T*>(xs), N));
+    else
+      return super::tuple(xs);
+  }
+
 private:
   /// Stores the serialized output.
   byte_buffer& buf_;
@@ -74,7 +74,14 @@ namespace caf::defaults::scheduler {
 constexpr auto policy = string_view{"stealing"};
 constexpr auto profiling_output_file = string_view{""};
 constexpr auto max_throughput = std::numeric_limits<size_t>::max();
+constexpr auto max_throughput_time = timespan{0};
 constexpr auto profiling_resolution = timespan(100'000'000);
+constexpr auto pin_workers = false;
+constexpr auto topology_aware_stealing = false;
+constexpr auto lifo_slot_limit = size_t{0};
+constexpr auto clock = string_view{"simple"};
+constexpr auto clock_resolution = timespan{1'000'000};
+constexpr auto worker_timers = false;
 
 } // namespace caf::defaults::scheduler
 
@@ -87,9 +94,17 @@ constexpr auto moderate_steal_interval = size_t{5};
 constexpr auto moderate_sleep_duration = timespan{50'000};
 constexpr auto relaxed_steal_interval = size_t{1};
 constexpr auto relaxed_sleep_duration = timespan{10'000'000};
+constexpr auto batch_steal = false;
 
 } // namespace caf::defaults::work_stealing
 
+namespace caf::defaults::memory_pool {
+
+constexpr auto enable = false;
+constexpr auto max_cached_blocks = size_t{64};
+
+} // namespace caf::defaults::memory_pool
+
 namespace caf::defaults::logger::file {
 
 constexpr auto format = string_view{"%r %c %p %a %t %C %M %F:%L %m%n"};
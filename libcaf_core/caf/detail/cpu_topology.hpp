@@ -0,0 +1,42 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/master/LICENSE.
+
+#pragma once
+
+#include <vector>
+
+#include "caf/detail/core_export.hpp"
+#include "caf/string_view.hpp"
+
+namespace caf::detail {
+
+/// Describes the locality of a single logical CPU.
+struct cpu_info {
+  /// Logical CPU ID as used by the operating system.
+  int id;
+
+  /// Identifies the group of CPUs sharing the last-level cache, i.e., the
+  /// lowest CPU ID in the group.
+  int cache_group;
+
+  /// NUMA node of the CPU.
+  int node;
+};
+
+/// Parses a CPU list such as `0-3,8,10-11` from the Linux sysfs.
+/// @returns the sorted list of CPU IDs or an empty list on a parser error.
+CAF_CORE_EXPORT std::vector<int> parse_cpu_list(string_view str);
+
+/// Discovers all online CPUs of this machine and their locality. The result is
+/// sorted by NUMA node, cache group and CPU ID.
+/// @returns the CPU topology or an empty list if the platform does not
+///          support topology discovery (currently Linux only).
+CAF_CORE_EXPORT std::vector<cpu_info> cpu_topology();
+
+/// Restricts the calling thread to run only on the logical CPU `id`.
+/// @returns `true` on success, `false` if the OS rejected the request or if the
+///          platform does not support CPU affinity (currently Linux only).
+CAF_CORE_EXPORT bool pin_this_thread(int id);
+
+} // namespace caf::detail
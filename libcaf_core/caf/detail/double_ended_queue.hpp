@@ -9,6 +9,8 @@
 #include <atomic>
 #include <cassert>
 #include <chrono>
+#include <cstddef>
+#include <memory>
 #include <thread>
 
 // GCC hack
@@ -183,6 +185,45 @@ public:
     return result;
   }
 
+  // acquires both locks, then the tail lock of `dst`, returns nullptr on
+  // failure; moves up to half of the elements at the tail of this queue to
+  // the tail of `dst` except for the last element, which is returned
+  pointer take_tail_half(double_ended_queue& dst) {
+    CAF_ASSERT(&dst != this);
+    node* first = nullptr;
+    node* last = nullptr;
+    { // lifetime scope of guards
+      lock_guard guard1(head_lock_);
+      lock_guard guard2(tail_lock_);
+      CAF_ASSERT(head_ != nullptr);
+      auto pred = head_.load();
+      last = tail_.load();
+      if (last == pred)
+        return nullptr;
+      size_t size = 0;
+      for (auto i = pred->next.load(); i != nullptr; i = i->next)
+        ++size;
+      // skip all elements we leave in this queue
+      for (auto n = size - (size + 1) / 2; n > 0; --n)
+        pred = pred->next;
+      first = pred->next;
+      pred->next = nullptr;
+      tail_ = pred;
+    }
+    unique_node_ptr last_ptr{last};
+    auto result = last->value;
+    if (first != last) {
+      auto new_tail = first;
+      while (new_tail->next != last)
+        new_tail = new_tail->next;
+      new_tail->next = nullptr;
+      lock_guard guard(dst.tail_lock_);
+      dst.tail_.load()->next = first;
+      dst.tail_ = new_tail;
+    }
+    return result;
+  }
+
   // does not lock
   bool empty() const {
     // atomically compares first and last pointer without locks
@@ -0,0 +1,106 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/master/LICENSE.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+namespace caf::detail {
+
+/// An event count allows threads to wait for a condition without a lock on the
+/// fast path. Waiters announce themselves with `prepare_wait`, re-check their
+/// condition and then either call `cancel_wait` or block in `wait_for`.
+/// Notifiers first make the condition true and then call `notify_one` or
+/// `notify_all`, which only touch the mutex if at least one thread is waiting.
+class event_count {
+public:
+  using key_type = uint32_t;
+
+  event_count() : state_(0) {
+    // nop
+  }
+
+  event_count(const event_count&) = delete;
+
+  event_count& operator=(const event_count&) = delete;
+
+  /// Announces that the calling thread is about to wait.
+  /// @returns a key for `wait_for`.
+  key_type prepare_wait() noexcept {
+    return epoch(state_.fetch_add(1));
+  }
+
+  /// Withdraws a previous call to `prepare_wait`.
+  void cancel_wait() noexcept {
+    state_.fetch_sub(1);
+  }
+
+  /// Blocks until a notification arrives after the call to `prepare_wait`
+  /// that returned `key` or until `timeout` expires.
+  /// @returns `true` if the thread received a notification, `false` on
+  ///          timeout.
+  template <class Rep, class Period>
+  bool wait_for(key_type key, std::chrono::duration<Rep, Period> timeout) {
+    bool result;
+    { // lifetime scope of guard
+      std::unique_lock<std::mutex> guard{mtx_};
+      result = cv_.wait_for(guard, timeout,
+                            [&] { return epoch(state_.load()) != key; });
+    }
+    state_.fetch_sub(1);
+    return result;
+  }
+
+  /// Wakes up one waiting thread, if any.
+  void notify_one() {
+    if (has_waiters()) {
+      advance_epoch();
+      cv_.notify_one();
+    }
+  }
+
+  /// Wakes up all waiting threads, if any.
+  void notify_all() {
+    if (has_waiters()) {
+      advance_epoch();
+      cv_.notify_all();
+    }
+  }
+
+  /// Queries whether at least one thread called `prepare_wait` without calling
+  /// `cancel_wait` or returning from `wait_for` yet.
+  bool has_waiters() const noexcept {
+    return (state_.load() & waiters_mask) != 0;
+  }
+
+private:
+  static constexpr uint64_t waiters_mask = 0xFFFFFFFF;
+
+  static constexpr uint64_t epoch_increment = uint64_t{1} << 32;
+
+  static key_type epoch(uint64_t state) noexcept {
+    return static_cast<key_type>(state >> 32);
+  }
+
+  void advance_epoch() {
+    // Modifying the epoch while holding the mutex makes sure that a waiter
+    // either sees the new epoch or is already blocked on the condition.
+    std::unique_lock<std::mutex> guard{mtx_};
+    state_.fetch_add(epoch_increment);
+  }
+
+  // Stores the number of waiters in the lower 32 bits and the epoch in the
+  // upper 32 bits.
+  std::atomic<uint64_t> state_;
+
+  std::mutex mtx_;
+
+  std::condition_variable cv_;
+};
+
+} // namespace caf::detail
@@ -0,0 +1,105 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/master/LICENSE.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "caf/detail/core_export.hpp"
+
+namespace caf::detail {
+
+/// A process-wide allocator for small, short-lived objects such as mailbox
+/// elements and message data. Each thread keeps free lists of recycled memory
+/// blocks for a fixed set of size classes. Releasing a block always puts it
+/// into the free list of the calling thread, i.e., blocks migrate to the
+/// threads that consume messages.
+///
+/// Pooling is disabled by default, in which case `allocate` and `deallocate`
+/// simply forward to `malloc` and `free` without rounding up to a size class.
+/// Every block carries a small header with its size class, so blocks remain
+/// valid when enabling or disabling the pool at runtime.
+///
+/// Further, `allocate_pair` places two objects with independent lifetimes into
+/// a single block. The block becomes available again after releasing both
+/// objects.
+class CAF_CORE_EXPORT memory_pool {
+public:
+  // -- constants --------------------------------------------------------------
+
+  /// Number of bytes in front of each block for storing its size class.
+  /// Also determines the alignment of all blocks.
+  static constexpr size_t header_size = 16;
+
+  /// Granularity of the size classes, including the header.
+  static constexpr size_t size_class_step = 64;
+
+  /// Number of size classes. Larger blocks bypass the pool.
+  static constexpr size_t num_size_classes = 8;
+
+  /// Maximum size for allocations that the pool is able to recycle.
+  static constexpr size_t max_pooled_size
+    = num_size_classes * size_class_step - header_size;
+
+  // -- nested types -----------------------------------------------------------
+
+  /// Counts how many allocations the pool was able to serve from a free list
+  /// (hits) and how many required a fresh block from the system (misses).
+  struct statistics {
+    uint64_t hits;
+    uint64_t misses;
+  };
+
+  // -- allocation -------------------------------------------------------------
+
+  /// Allocates a block with at least `size` bytes.
+  /// @returns a pointer to the block or `nullptr` if the system is out of
+  ///          memory.
+  static void* allocate(size_t size) noexcept;
+
+  /// Allocates a single block for two objects of `first_size` and
+  /// `second_size` bytes. Releasing the block requires calling `deallocate`
+  /// for both objects, in any order.
+  /// @param second Receives the memory location of the second object.
+  /// @returns the memory location of the first object or `nullptr` if the
+  ///          system is out of memory.
+  static void* allocate_pair(size_t first_size, size_t second_size,
+                             void*& second) noexcept;
+
+  /// Returns the offset of the second object in a block from `allocate_pair`.
+  static constexpr size_t pair_offset(size_t first_size) noexcept {
+    return (first_size + header_size - 1) / header_size * header_size
+           + header_size;
+  }
+
+  /// Releases a block previously returned by `allocate` or one of the objects
+  /// of a block returned by `allocate_pair`. Passing `nullptr` is a no-op.
+  static void deallocate(void* ptr) noexcept;
+
+  // -- configuration ----------------------------------------------------------
+
+  /// Enables or disables recycling of memory blocks.
+  static void enable(bool value) noexcept;
+
+  /// Queries whether the pool recycles memory blocks.
+  static bool enabled() noexcept;
+
+  /// Sets the maximum number of blocks per size class that each thread keeps
+  /// in its free lists.
+  static void max_cached_blocks(size_t value) noexcept;
+
+  /// Returns the maximum number of blocks per size class that each thread
+  /// keeps in its free lists.
+  static size_t max_cached_blocks() noexcept;
+
+  // -- statistics -------------------------------------------------------------
+
+  /// Returns the number of pool hits and misses across all threads. Threads
+  /// publish their counts periodically, so the result may lag behind slightly
+  /// for threads other than the calling one.
+  static statistics stats() noexcept;
+};
+
+} // namespace caf::detail
@@ -12,6 +12,7 @@
 #include "caf/config.hpp"
 #include "caf/detail/core_export.hpp"
 #include "caf/detail/implicit_conversions.hpp"
+#include "caf/detail/memory_pool.hpp"
 #include "caf/detail/padded_size.hpp"
 #include "caf/fwd.hpp"
 #include "caf/type_id_list.hpp"
@@ -61,7 +62,7 @@ public:
   void deref() noexcept {
     if (unique() || rc_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
       this->~message_data();
-      free(const_cast<message_data*>(this));
+      memory_pool::deallocate(const_cast<message_data*>(this));
     }
   }
 
@@ -0,0 +1,67 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/master/LICENSE.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "caf/abstract_actor.hpp"
+#include "caf/actor_clock.hpp"
+#include "caf/actor_control_block.hpp"
+#include "caf/config.hpp"
+#include "caf/fwd.hpp"
+#include "caf/message_id.hpp"
+
+namespace caf::detail {
+
+/// Cancels the shared timeout of a request group, e.g., the requests of a
+/// fan-out request, when going out of scope. Merge policies store a guard in
+/// the response handler for all requests of the group. Hence, the actor
+/// destroys the guard only after removing the handlers for all requests,
+/// i.e., after receiving all responses or errors.
+/// @warning The guard holds a raw pointer to the actor and calls the clock in
+///          its destructor. Only the owning actor may destroy the guard, i.e.,
+///          by dropping its response handlers while processing a message,
+///          calling `quit` or running its cleanup. Scheduled actors clear
+///          their response handlers before setting `is_cleaned_up_flag`.
+class request_group_guard {
+public:
+  request_group_guard(actor_clock& clock, abstract_actor* self,
+                      message_id first_id) noexcept
+    : clock_(clock), self_(self), first_id_(first_id) {
+    // nop
+  }
+
+  request_group_guard(const request_group_guard&) = delete;
+
+  request_group_guard& operator=(const request_group_guard&) = delete;
+
+  ~request_group_guard() {
+    CAF_ASSERT(!self_->getf(abstract_actor::is_cleaned_up_flag));
+    clock_.cancel_request_timeout(self_, first_id_);
+  }
+
+private:
+  actor_clock& clock_;
+  abstract_actor* self_;
+  message_id first_id_;
+};
+
+/// @relates request_group_guard
+using request_group_guard_ptr = std::shared_ptr<request_group_guard>;
+
+/// Creates a guard for the requests `ids` of `self`.
+/// @relates request_group_guard
+template <class Self>
+request_group_guard_ptr
+make_request_group_guard(Self* self, const std::vector<message_id>& ids) {
+  if (ids.size() < 2)
+    return nullptr;
+  return std::make_shared<request_group_guard>(self->clock(),
+                                               self->ctrl()->get(),
+                                               ids.front());
+}
+
+} // namespace caf::detail
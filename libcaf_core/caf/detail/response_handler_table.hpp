@@ -0,0 +1,124 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/master/LICENSE.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "caf/behavior.hpp"
+#include "caf/detail/core_export.hpp"
+#include "caf/message_id.hpp"
+
+namespace caf::detail {
+
+/// Maps response IDs to response handlers with constant lookup, insertion and
+/// removal. The table stores each handler directly in the slot at
+/// `request_id & (capacity() - 1)`. Since actors assign request IDs in
+/// ascending order, pending requests of an actor usually fall into distinct
+/// slots. On a collision, the table doubles its capacity until the new handler
+/// has a slot of its own, as long as at least one in `max_sparseness` slots
+/// remains occupied. Otherwise, e.g., when a single request remains pending
+/// for a long time, the handler goes to an overflow map instead.
+class CAF_CORE_EXPORT response_handler_table {
+public:
+  // -- constants --------------------------------------------------------------
+
+  /// Number of slots after the first insertion.
+  static constexpr size_t min_capacity = 16;
+
+  /// Limits how many slots per handler the table may allocate to resolve a
+  /// collision.
+  static constexpr size_t max_sparseness = 16;
+
+  // -- constructors, destructors, and assignment operators --------------------
+
+  response_handler_table() = default;
+
+  response_handler_table(response_handler_table&&) = default;
+
+  response_handler_table& operator=(response_handler_table&&) = default;
+
+  // -- properties -------------------------------------------------------------
+
+  /// Returns the number of stored handlers.
+  size_t size() const noexcept {
+    return size_;
+  }
+
+  /// Queries whether the table stores no handlers.
+  bool empty() const noexcept {
+    return size_ == 0;
+  }
+
+  /// Returns the number of slots.
+  size_t capacity() const noexcept {
+    return slots_.size();
+  }
+
+  /// Returns the number of handlers that did not fit into their slot.
+  size_t overflow_size() const noexcept {
+    return overflow_.size();
+  }
+
+  // -- modifiers --------------------------------------------------------------
+
+  /// Stores `bhvr` as handler for the response `id` unless the table already
+  /// contains a handler for `id`.
+  /// @returns `true` if the table stores `bhvr`, `false` otherwise.
+  /// @pre `id.is_response()`
+  bool emplace(message_id id, behavior bhvr);
+
+  /// Returns the handler for `id` or `nullptr` if no such handler exists.
+  behavior* find(message_id id) noexcept;
+
+  /// Removes the handler for `id` from the table and moves it to `result`.
+  /// @returns `true` if the table contained a handler for `id`, `false`
+  ///          otherwise.
+  bool take(message_id id, behavior& result);
+
+  /// Removes the handler for `id` from the table.
+  /// @returns `true` if the table contained a handler for `id`, `false`
+  ///          otherwise.
+  bool erase(message_id id);
+
+  /// Removes all handlers and releases the slots.
+  void clear() noexcept;
+
+private:
+  // -- member types -----------------------------------------------------------
+
+  struct slot {
+    /// Stores the integer value of the response ID or 0 for empty slots.
+    uint64_t key = 0;
+
+    behavior value;
+  };
+
+  // -- helper functions -------------------------------------------------------
+
+  /// Returns the slot for `key`.
+  slot& slot_of(uint64_t key) noexcept {
+    auto pos = static_cast<size_t>(key & message_id::request_id_mask);
+    return slots_[pos & (slots_.size() - 1)];
+  }
+
+  /// Doubles the number of slots.
+  void grow();
+
+  // -- member variables -------------------------------------------------------
+
+  /// Stores the handlers. The size is always 0 or a power of two.
+  std::vector<slot> slots_;
+
+  /// Stores handlers that collide with another handler in `slots_`.
+  std::unordered_map<uint64_t, behavior> overflow_;
+
+  /// Number of stored handlers.
+  size_t size_ = 0;
+};
+
+} // namespace caf::detail
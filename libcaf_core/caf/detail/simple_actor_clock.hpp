@@ -7,15 +7,18 @@
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <vector>
 
 #include "caf/actor_clock.hpp"
 #include "caf/actor_control_block.hpp"
 #include "caf/detail/core_export.hpp"
 #include "caf/detail/make_unique.hpp"
 #include "caf/group.hpp"
+#include "caf/intrusive/singly_linked.hpp"
 #include "caf/mailbox_element.hpp"
 #include "caf/message.hpp"
 #include "caf/message_id.hpp"
+#include "caf/optional.hpp"
 #include "caf/variant.hpp"
 
 namespace caf::detail {
@@ -55,8 +58,10 @@ public:
     shutdown_type,
   };
 
-  /// Base class for clock events.
-  struct event {
+  /// Base class for clock events. The intrusive `next` pointer allows
+  /// `thread_safe_actor_clock` to pass events between threads without
+  /// allocating queue nodes.
+  struct event : intrusive::singly_linked<event> {
     event(event_type t) : subtype(t) {
       // nop
     }
@@ -78,6 +83,21 @@ public:
 
     /// Links back to the actor lookup map.
     actor_lookup_map::iterator backlink;
+
+    /// Links events in the same slot of a `timing_wheel_actor_clock`.
+    delayed_event* slot_prev = nullptr;
+
+    /// Links events in the same slot of a `timing_wheel_actor_clock`.
+    delayed_event* slot_next = nullptr;
+
+    /// Links events of the same actor in a `timing_wheel_actor_clock`.
+    delayed_event* actor_prev = nullptr;
+
+    /// Links events of the same actor in a `timing_wheel_actor_clock`.
+    delayed_event* actor_next = nullptr;
+
+    /// Stores the slot index in a `timing_wheel_actor_clock`.
+    size_t slot = 0;
   };
 
   /// An ordinary timeout event for actors. Only one timeout for any timeout
@@ -119,7 +139,8 @@ public:
   };
 
   /// A delayed `sec::request_timeout` error that gets cancelled when the
-  /// request arrives in time.
+  /// request arrives in time. A single entry may cover a group of requests
+  /// that share the same deadline, e.g., the requests of a fan-out request.
   struct request_timeout final : delayed_event {
     static constexpr bool cancellable = true;
 
@@ -130,8 +151,22 @@ public:
       // nop
     }
 
+    request_timeout(time_point due, strong_actor_ptr self,
+                    std::vector<message_id> ids)
+      : delayed_event(request_timeout_type, due),
+        self(std::move(self)),
+        id(ids.front()),
+        group(std::move(ids)) {
+      // nop
+    }
+
     strong_actor_ptr self;
+
+    /// Identifies this entry. For groups, this is the first ID of the group.
     message_id id;
+
+    /// Stores all IDs of a group or remains empty for single requests.
+    std::vector<message_id> group;
   };
 
   /// A delayed ::message to an actor.
@@ -261,6 +296,16 @@ public:
   /// @private
   size_t trigger_expired_timeouts();
 
+  /// Returns the time point of the next pending timeout or `none` if the
+  /// schedule is empty.
+  /// @private
+  optional<time_point> next_timeout() const;
+
+  /// Delivers the message or timeout stored in `x`. Passing an execution
+  /// context allows the receiver to run on the calling worker.
+  /// @private
+  static void ship(delayed_event& x, execution_unit* ctx = nullptr);
+
   // -- overridden member functions --------------------------------------------
 
   void set_ordinary_timeout(time_point t, abstract_actor* self,
@@ -272,6 +317,9 @@ public:
   void set_request_timeout(time_point t, abstract_actor* self,
                            message_id id) override;
 
+  void set_request_group_timeout(time_point t, abstract_actor* self,
+                                 std::vector<message_id> ids) override;
+
   void cancel_ordinary_timeout(abstract_actor* self, std::string type) override;
 
   void cancel_request_timeout(abstract_actor* self, message_id id) override;
@@ -323,7 +371,7 @@ protected:
 
   void handle(const timeouts_cancellation& x);
 
-  void ship(delayed_event& x);
+  void clear_schedule();
 
   template <class T>
   detail::enable_if_t<T::cancellable>
@@ -4,30 +4,52 @@
 
 #pragma once
 
-#include <array>
-#include <atomic>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
 
 #include "caf/abstract_actor.hpp"
 #include "caf/detail/core_export.hpp"
-#include "caf/detail/ringbuffer.hpp"
 #include "caf/detail/simple_actor_clock.hpp"
+#include "caf/detail/timing_wheel_actor_clock.hpp"
+#include "caf/intrusive/lifo_inbox.hpp"
+#include "caf/timespan.hpp"
 
 namespace caf::detail {
 
 class CAF_CORE_EXPORT thread_safe_actor_clock : public simple_actor_clock {
 public:
-  // -- constants --------------------------------------------------------------
-
-  static constexpr size_t buffer_size = 64;
-
   // -- member types -----------------------------------------------------------
 
   using super = simple_actor_clock;
 
+  /// Configures the queue for passing events to the clock thread.
+  struct event_queue_policy {
+    using mapped_type = event;
+
+    using unique_pointer = unique_event_ptr;
+  };
+
+  /// Lock-free queue for passing events to the clock thread. Producers only
+  /// acquire the mutex for waking up the clock thread after it went to sleep.
+  using event_queue = intrusive::lifo_inbox<event_queue_policy>;
+
+  /// Receives cancellations from other threads for the timer shard of a
+  /// single thread.
+  struct shard_inbox {
+    explicit shard_inbox(timing_wheel_actor_clock* shard) : shard(shard) {
+      // nop
+    }
+
+    /// Points to the timer shard that only the owning thread may access.
+    timing_wheel_actor_clock* shard;
+
+    /// Stores pending cancellations for `shard`.
+    event_queue queue;
+  };
+
   // -- member functions -------------------------------------------------------
 
   void set_ordinary_timeout(time_point t, abstract_actor* self,
@@ -36,6 +58,9 @@ public:
   void set_request_timeout(time_point t, abstract_actor* self,
                            message_id id) override;
 
+  void set_request_group_timeout(time_point t, abstract_actor* self,
+                                 std::vector<message_id> ids) override;
+
   void set_multi_timeout(time_point t, abstract_actor* self, std::string type,
                          uint64_t id) override;
 
@@ -53,6 +78,31 @@ public:
 
   void cancel_all() override;
 
+  /// Stores all timeouts and delayed messages in a timing wheel with given
+  /// resolution instead of a sorted map. Must get called before starting the
+  /// dispatch loop.
+  void use_timing_wheel(timespan resolution);
+
+  /// Returns the timing wheel or `nullptr` if this clock uses the default
+  /// schedule.
+  const timing_wheel_actor_clock* timing_wheel() const noexcept {
+    return wheel_.get();
+  }
+
+  /// Routes timeouts and delayed messages from the calling thread to `shard`
+  /// instead of the clock thread. Passing `nullptr` restores the default.
+  /// Cancellations always reach the clock thread as well, because actors may
+  /// have set timeouts from other threads. When an actor that set timeouts in
+  /// a shard cancels all of its timeouts, e.g., after terminating, the
+  /// cancellation also goes to all other shards.
+  /// @warning Only the calling thread may access `shard` afterwards.
+  void bind_local_shard(timing_wheel_actor_clock* shard);
+
+  /// Applies cancellations that other threads sent to the timer shard of the
+  /// calling thread.
+  /// @returns the number of applied cancellations.
+  size_t handle_remote_cancellations();
+
   void run_dispatch_loop();
 
   void cancel_dispatch_loop();
@@ -60,11 +110,28 @@ public:
 private:
   void push(event* ptr);
 
+  timing_wheel_actor_clock* local_shard() const noexcept;
+
+  template <class Backend>
+  void run_dispatch_loop(Backend& backend);
+
+  /// Replaces the inherited schedule if present.
+  std::unique_ptr<timing_wheel_actor_clock> wheel_;
+
   /// Receives timer events from other threads.
-  detail::ringbuffer<unique_event_ptr, buffer_size> queue_;
+  event_queue queue_;
+
+  /// Protects `cv_` for waking up the clock thread.
+  std::mutex mtx_;
+
+  /// Signals new events to the clock thread when blocked.
+  std::condition_variable cv_;
+
+  /// Protects `shards_`.
+  std::mutex shards_mtx_;
 
-  /// Locally caches events for processing.
-  std::array<unique_event_ptr, buffer_size> events_;
+  /// Stores the inboxes of all bound timer shards.
+  std::vector<std::unique_ptr<shard_inbox>> shards_;
 };
 
 } // namespace caf::detail
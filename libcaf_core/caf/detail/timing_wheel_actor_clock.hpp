@@ -0,0 +1,276 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/master/LICENSE.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+
+#include "caf/actor_clock.hpp"
+#include "caf/detail/core_export.hpp"
+#include "caf/detail/simple_actor_clock.hpp"
+#include "caf/optional.hpp"
+#include "caf/timespan.hpp"
+
+namespace caf::detail {
+
+/// An actor clock that stores timeouts in a hierarchical timing wheel. Unlike
+/// `simple_actor_clock`, which keeps all timeouts in a sorted map, this clock
+/// schedules and cancels timeouts in constant time. In exchange, the clock
+/// rounds all due times up to its resolution, i.e., timeouts trigger up to one
+/// tick late but never early. Timeouts that become due within the same tick
+/// may trigger in any order.
+///
+/// The wheel has four levels. The first level has one slot per tick for the
+/// next 256 ticks, each further level covers a 64 times larger range with
+/// 64 slots. Whenever the first level completes a rotation, the clock moves
+/// the timeouts from the next slot of the second level down to the first
+/// level, and so on. With the default resolution of 1ms, the wheel covers
+/// roughly 18 hours. The clock parks timeouts with larger delays in the last
+/// level until they fall into range.
+class CAF_CORE_EXPORT timing_wheel_actor_clock : public actor_clock {
+public:
+  // -- member types -----------------------------------------------------------
+
+  using event = simple_actor_clock::event;
+
+  using delayed_event = simple_actor_clock::delayed_event;
+
+  using ordinary_timeout = simple_actor_clock::ordinary_timeout;
+
+  using multi_timeout = simple_actor_clock::multi_timeout;
+
+  using request_timeout = simple_actor_clock::request_timeout;
+
+  using actor_msg = simple_actor_clock::actor_msg;
+
+  using group_msg = simple_actor_clock::group_msg;
+
+  using ordinary_timeout_cancellation
+    = simple_actor_clock::ordinary_timeout_cancellation;
+
+  using multi_timeout_cancellation
+    = simple_actor_clock::multi_timeout_cancellation;
+
+  using request_timeout_cancellation
+    = simple_actor_clock::request_timeout_cancellation;
+
+  using timeouts_cancellation = simple_actor_clock::timeouts_cancellation;
+
+  /// Counts time in multiples of the resolution.
+  using tick_type = uint64_t;
+
+  // -- constants --------------------------------------------------------------
+
+  /// Number of levels in the wheel.
+  static constexpr size_t num_levels = 4;
+
+  /// Number of bits for selecting a slot on the first level.
+  static constexpr size_t first_level_bits = 8;
+
+  /// Number of bits for selecting a slot on all other levels.
+  static constexpr size_t level_bits = 6;
+
+  /// Number of slots across all levels.
+  static constexpr size_t num_slots
+    = (size_t{1} << first_level_bits)
+      + (num_levels - 1) * (size_t{1} << level_bits);
+
+  /// Number of ticks the wheel covers.
+  static constexpr tick_type max_delay
+    = tick_type{1} << (first_level_bits + (num_levels - 1) * level_bits);
+
+  // -- constructors, destructors, and assignment operators --------------------
+
+  explicit timing_wheel_actor_clock(timespan resolution = timespan{1'000'000});
+
+  timing_wheel_actor_clock(const timing_wheel_actor_clock&) = delete;
+
+  timing_wheel_actor_clock& operator=(const timing_wheel_actor_clock&) = delete;
+
+  ~timing_wheel_actor_clock() override;
+
+  // -- properties -------------------------------------------------------------
+
+  /// Returns the length of a single tick.
+  timespan resolution() const noexcept {
+    return resolution_;
+  }
+
+  /// Returns the number of pending timeouts and messages.
+  size_t size() const noexcept {
+    return size_;
+  }
+
+  /// Queries whether the clock has no pending timeouts and messages.
+  bool empty() const noexcept {
+    return size_ == 0;
+  }
+
+  // -- convenience functions --------------------------------------------------
+
+  /// Triggers all timeouts with timestamp <= now. Passing an execution context
+  /// allows receivers to run on the calling worker.
+  /// @returns The number of triggered timeouts.
+  /// @private
+  size_t trigger_expired_timeouts(execution_unit* ctx = nullptr);
+
+  /// Returns the time point when the clock needs to advance next or `none` if
+  /// the schedule is empty. The result may lie before the next timeout, since
+  /// the clock also needs to advance for moving timeouts between levels.
+  /// @private
+  optional<time_point> next_timeout() const;
+
+  /// Takes ownership of `x` and adds it to the wheel.
+  /// @private
+  template <class T>
+  void add_schedule_entry(std::unique_ptr<T> x) {
+    insert(x.release());
+  }
+
+  /// @private
+  void handle(const ordinary_timeout_cancellation& x);
+
+  /// @private
+  void handle(const multi_timeout_cancellation& x);
+
+  /// @private
+  void handle(const request_timeout_cancellation& x);
+
+  /// @private
+  void handle(const timeouts_cancellation& x);
+
+  /// Drops all pending timeouts and messages.
+  /// @private
+  void clear_schedule();
+
+  // -- overridden member functions --------------------------------------------
+
+  void set_ordinary_timeout(time_point t, abstract_actor* self,
+                            std::string type, uint64_t id) override;
+
+  void set_multi_timeout(time_point t, abstract_actor* self, std::string type,
+                         uint64_t id) override;
+
+  void set_request_timeout(time_point t, abstract_actor* self,
+                           message_id id) override;
+
+  void set_request_group_timeout(time_point t, abstract_actor* self,
+                                 std::vector<message_id> ids) override;
+
+  void cancel_ordinary_timeout(abstract_actor* self, std::string type) override;
+
+  void cancel_request_timeout(abstract_actor* self, message_id id) override;
+
+  void cancel_timeouts(abstract_actor* self) override;
+
+  void schedule_message(time_point t, strong_actor_ptr receiver,
+                        mailbox_element_ptr content) override;
+
+  void schedule_message(time_point t, group target, strong_actor_ptr sender,
+                        message content) override;
+
+  void cancel_all() override;
+
+private:
+  // -- member types -----------------------------------------------------------
+
+  /// An intrusive, doubly linked list of events in the same slot.
+  struct slot_list {
+    delayed_event* head = nullptr;
+    delayed_event* tail = nullptr;
+  };
+
+  /// Heads of the intrusive lists for all cancellable events of an actor.
+  struct actor_events {
+    /// Lists all ordinary and multi timeouts.
+    delayed_event* timeouts = nullptr;
+
+    /// Lists all request timeouts.
+    delayed_event* requests = nullptr;
+  };
+
+  /// Identifies a request timeout.
+  struct request_key {
+    actor_id aid;
+    uint64_t mid;
+
+    bool operator==(const request_key& other) const noexcept {
+      return aid == other.aid && mid == other.mid;
+    }
+  };
+
+  struct request_key_hash {
+    size_t operator()(const request_key& x) const noexcept;
+  };
+
+  // -- helper functions -------------------------------------------------------
+
+  template <class T, class... Ts>
+  void new_schedule_entry(time_point t, Ts&&... xs) {
+    insert(new T(t, std::forward<Ts>(xs)...));
+  }
+
+  /// Rounds `t` up to the next tick.
+  tick_type to_due_tick(time_point t) const noexcept;
+
+  /// Rounds `t` down to the previous tick.
+  tick_type to_tick(time_point t) const noexcept;
+
+  /// Converts a tick back to a time point.
+  time_point to_time_point(tick_type tick) const noexcept;
+
+  /// Adds `x` to the wheel and to the secondary indexes.
+  void insert(delayed_event* x);
+
+  /// Puts `x` into the slot for `tick` relative to the current tick.
+  void place(delayed_event* x, tick_type tick);
+
+  /// Removes `x` from its slot.
+  void unlink_slot(delayed_event* x) noexcept;
+
+  /// Removes `x` from the secondary indexes.
+  void unlink_actor(delayed_event* x);
+
+  /// Removes `x` from the wheel and destroys it.
+  void erase(delayed_event* x);
+
+  /// Returns the next tick with a non-empty slot on any level.
+  optional<tick_type> next_tick() const noexcept;
+
+  /// Moves the events of all upper-level slots that expire at the current tick
+  /// down the hierarchy.
+  void cascade();
+
+  /// Ships all events in the first-level slot of the current tick.
+  size_t fire(execution_unit* ctx);
+
+  // -- member variables -------------------------------------------------------
+
+  /// Length of a single tick.
+  timespan resolution_;
+
+  /// The last tick the clock has processed.
+  tick_type cur_ = 0;
+
+  /// Number of pending events.
+  size_t size_ = 0;
+
+  /// Number of pending events per level.
+  std::array<size_t, num_levels> level_sizes_ = {};
+
+  /// Stores the events of all levels.
+  std::array<slot_list, num_slots> slots_;
+
+  /// Secondary index for accessing timeouts by actor.
+  std::unordered_map<actor_id, actor_events> actor_lookup_;
+
+  /// Secondary index for accessing request timeouts by message ID.
+  std::unordered_map<request_key, delayed_event*, request_key_hash>
+    request_lookup_;
+};
+
+} // namespace caf::detail
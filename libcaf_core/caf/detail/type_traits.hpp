@@ -1029,6 +1029,13 @@ struct is_builtin_inspector_type<span<const byte>, false> {
   static constexpr bool value = true;
 };
 
+/// Checks whether binary inspectors may process a sequence of `T` values at
+/// once instead of dispatching on each element.
+template <class T>
+constexpr bool is_bulk_inspectable_v
+  = is_one_of<T, int8_t, uint8_t, int16_t, uint16_t, int32_t, uint32_t,
+              int64_t, uint64_t, float, double>::value;
+
 } // namespace caf::detail
 
 #undef CAF_HAS_MEMBER_TRAIT
@@ -0,0 +1,109 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/master/LICENSE.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#include "caf/detail/memory_pool.hpp"
+
+namespace caf::detail {
+
+/// Recycles the memory of objects of type `T` via thread-local free lists.
+/// Unlike `memory_pool`, each type has free lists of its own and blocks carry
+/// no header, which makes this pool suitable for large, over-aligned objects
+/// such as `actor_storage<T>`.
+///
+/// The pool shares its settings with `memory_pool`: it only recycles blocks
+/// while `memory_pool::enabled()` returns `true` and each thread keeps at most
+/// `memory_pool::max_cached_blocks()` blocks per type.
+template <class T>
+class typed_memory_pool {
+public:
+  // -- allocation -------------------------------------------------------------
+
+  /// Allocates a block for a single `T`.
+  /// @throws std::bad_alloc if the system is out of memory.
+  static void* allocate() {
+    if (memory_pool::enabled())
+      if (auto cache = local_cache(); cache != nullptr && cache->head) {
+        auto block = cache->head;
+        cache->head = block->next;
+        --cache->size;
+        return block;
+      }
+    return ::operator new(sizeof(T), std::align_val_t{alignof(T)});
+  }
+
+  /// Releases a block previously returned by `allocate`.
+  static void deallocate(void* ptr) noexcept {
+    if (memory_pool::enabled())
+      if (auto cache = local_cache();
+          cache != nullptr && cache->size < memory_pool::max_cached_blocks()) {
+        auto block = static_cast<free_block*>(ptr);
+        block->next = cache->head;
+        cache->head = block;
+        ++cache->size;
+        return;
+      }
+    ::operator delete(ptr, std::align_val_t{alignof(T)});
+  }
+
+  // -- properties -------------------------------------------------------------
+
+  /// Returns the number of blocks in the free list of the calling thread.
+  static size_t cached_blocks() noexcept {
+    auto cache = local_cache();
+    return cache != nullptr ? cache->size : 0;
+  }
+
+private:
+  // -- member types -----------------------------------------------------------
+
+  static_assert(sizeof(T) >= sizeof(void*));
+
+  // Overlays the first bytes of a free block to form a singly linked list.
+  struct free_block {
+    free_block* next;
+  };
+
+  struct thread_cache {
+    free_block* head = nullptr;
+
+    size_t size = 0;
+
+    ~thread_cache() {
+      state() = cache_state::destroyed;
+      while (head != nullptr) {
+        auto next = head->next;
+        ::operator delete(head, std::align_val_t{alignof(T)});
+        head = next;
+      }
+    }
+  };
+
+  enum class cache_state : uint8_t { uninitialized, alive, destroyed };
+
+  // -- utility functions ------------------------------------------------------
+
+  // Trivially destructible, i.e., remains accessible after the cache died.
+  // This allows releasing blocks during thread or process shutdown.
+  static cache_state& state() noexcept {
+    static thread_local cache_state result = cache_state::uninitialized;
+    return result;
+  }
+
+  static thread_cache* local_cache() noexcept {
+    auto& st = state();
+    if (st == cache_state::destroyed)
+      return nullptr;
+    static thread_local thread_cache cache;
+    st = cache_state::alive;
+    return &cache;
+  }
+};
+
+} // namespace caf::detail
@@ -0,0 +1,174 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/master/LICENSE.
+
+#pragma once
+
+#include "caf/config.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace caf::detail {
+
+/// A lock-free work-stealing deque for pointers based on the Chase-Lev
+/// algorithm, using the memory orderings from "Correct and Efficient
+/// Work-Stealing for Weak Memory Models" (Lê et al., PPoPP 2013).
+///
+/// Only a single thread (the owner) may call `push_bottom` and `pop_bottom`.
+/// Any number of threads may call `steal` concurrently. The deque stores its
+/// elements in a circular array that doubles in size when running full, i.e.,
+/// pushing a new element never allocates unless the deque needs to grow.
+/// Arrays that got replaced by a larger one stay alive until the deque gets
+/// destroyed, because thieves may still read from them.
+template <class T>
+class work_stealing_deque {
+public:
+  using value_type = T;
+  using pointer = value_type*;
+
+  static constexpr size_t default_capacity = 256;
+
+  /// @pre `initial_capacity` is a power of two
+  explicit work_stealing_deque(size_t initial_capacity = default_capacity)
+    : top_(0), bottom_(0) {
+    CAF_ASSERT(initial_capacity > 0);
+    CAF_ASSERT((initial_capacity & (initial_capacity - 1)) == 0);
+    arrays_.emplace_back(std::make_unique<array>(initial_capacity));
+    array_ = arrays_.back().get();
+  }
+
+  work_stealing_deque(const work_stealing_deque&) = delete;
+
+  work_stealing_deque& operator=(const work_stealing_deque&) = delete;
+
+  /// Adds a new element at the bottom of the deque.
+  /// @warning Must only be called by the owner.
+  void push_bottom(pointer value) {
+    CAF_ASSERT(value != nullptr);
+    auto b = bottom_.load(std::memory_order_relaxed);
+    auto t = top_.load(std::memory_order_acquire);
+    auto a = array_.load(std::memory_order_relaxed);
+    if (b - t > static_cast<int64_t>(a->capacity) - 1)
+      a = grow(a, b, t);
+    a->put(b, value);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom_.store(b + 1, std::memory_order_relaxed);
+  }
+
+  /// Removes the most recently pushed element from the deque.
+  /// @returns the removed element or `nullptr` if the deque is empty.
+  /// @warning Must only be called by the owner.
+  pointer pop_bottom() {
+    auto b = bottom_.load(std::memory_order_relaxed) - 1;
+    auto a = array_.load(std::memory_order_relaxed);
+    bottom_.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto t = top_.load(std::memory_order_relaxed);
+    if (t > b) {
+      // The deque was empty.
+      bottom_.store(b + 1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    auto result = a->get(b);
+    if (t == b) {
+      // Last element: race against thieves for it.
+      if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                        std::memory_order_relaxed))
+        result = nullptr;
+      bottom_.store(b + 1, std::memory_order_relaxed);
+    }
+    return result;
+  }
+
+  /// Removes the oldest element from the deque.
+  /// @returns the removed element or `nullptr` if the deque is empty or if
+  ///          another thread won the race for the oldest element.
+  /// @note Safe to call from any thread.
+  pointer steal() {
+    auto t = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto b = bottom_.load(std::memory_order_acquire);
+    if (t >= b)
+      return nullptr;
+    auto a = array_.load(std::memory_order_acquire);
+    auto result = a->get(t);
+    if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed))
+      return nullptr;
+    return result;
+  }
+
+  /// Returns an approximation of the number of elements in the deque.
+  size_t size() const noexcept {
+    auto b = bottom_.load(std::memory_order_relaxed);
+    auto t = top_.load(std::memory_order_relaxed);
+    return b > t ? static_cast<size_t>(b - t) : 0u;
+  }
+
+  /// Queries whether the deque is empty. The result may be outdated
+  /// immediately when called from a thread other than the owner.
+  bool empty() const noexcept {
+    return size() == 0;
+  }
+
+  /// Returns the capacity of the current circular array.
+  size_t capacity() const noexcept {
+    return array_.load(std::memory_order_relaxed)->capacity;
+  }
+
+private:
+  struct array {
+    explicit array(size_t n)
+      : capacity(n), mask(n - 1), buf(new std::atomic<pointer>[n]) {
+      // nop
+    }
+
+    pointer get(int64_t index) const noexcept {
+      return buf[static_cast<size_t>(index) & mask].load(
+        std::memory_order_relaxed);
+    }
+
+    void put(int64_t index, pointer value) noexcept {
+      buf[static_cast<size_t>(index) & mask].store(value,
+                                                   std::memory_order_relaxed);
+    }
+
+    size_t capacity;
+    size_t mask;
+    std::unique_ptr<std::atomic<pointer>[]> buf;
+  };
+
+  // precondition: called by the owner
+  array* grow(array* old, int64_t b, int64_t t) {
+    arrays_.emplace_back(std::make_unique<array>(old->capacity * 2));
+    auto result = arrays_.back().get();
+    for (auto i = t; i != b; ++i)
+      result->put(i, old->get(i));
+    array_.store(result, std::memory_order_release);
+    return result;
+  }
+
+  // Index of the oldest element, modified by thieves and the owner.
+  std::atomic<int64_t> top_;
+
+  // Avoids false sharing between thieves and the owner.
+  char pad1_[CAF_CACHE_LINE_SIZE - sizeof(std::atomic<int64_t>)];
+
+  // Index of the next free slot, modified only by the owner.
+  std::atomic<int64_t> bottom_;
+
+  // Avoids false sharing between thieves and the owner.
+  char pad2_[CAF_CACHE_LINE_SIZE - sizeof(std::atomic<int64_t>)];
+
+  // Points to the current circular array.
+  std::atomic<array*> array_;
+
+  // Keeps all arrays alive, since thieves may still access retired ones.
+  std::vector<std::unique_ptr<array>> arrays_;
+};
+
+} // namespace caf::detail
@@ -93,6 +93,20 @@ public:
     return push_back(new value_type(std::forward<Ts>(xs)...));
   }
 
+  /// Appends the chain starting at `first` to the inbox with a single CAS
+  /// operation. The elements of the chain are linked via `next` in FIFO order
+  /// and the last element has no successor. If the inbox has been closed, the
+  /// caller keeps ownership of the chain (in its original order).
+  inbox_result push_back_chain(pointer first) noexcept {
+    CAF_ASSERT(first != nullptr);
+    auto last = first;
+    auto head = reverse(first);
+    auto res = inbox_.push_front_chain(head, last);
+    if (res == inbox_result::queue_closed)
+      reverse(head);
+    return res;
+  }
+
   // -- backwards compatibility ------------------------------------------------
 
   /// @cond PRIVATE
@@ -210,6 +224,21 @@ public:
   }
 
 private:
+  // -- utility functions ------------------------------------------------------
+
+  /// Reverses the chain starting at `first` and returns the new head.
+  static pointer reverse(pointer first) noexcept {
+    node_pointer prev = nullptr;
+    node_pointer ptr = first;
+    while (ptr != nullptr) {
+      auto next = ptr->next;
+      ptr->next = prev;
+      prev = ptr;
+      ptr = next;
+    }
+    return lifo_inbox_type::promote(prev);
+  }
+
   // -- member variables -------------------------------------------------------
 
   /// Thread-safe LIFO inbox.
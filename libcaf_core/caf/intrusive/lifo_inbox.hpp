@@ -71,6 +71,30 @@ public:
     return push_front(x.release());
   }
 
+  /// Tries to enqueue the chain `[first, last]` to the inbox with a single CAS
+  /// operation. The chain must be linked in LIFO order, i.e., `first` becomes
+  /// the new head and `last` is the oldest element of the chain. Unlike
+  /// `push_front`, this function leaves the elements untouched if the queue
+  /// has been closed, i.e., the caller keeps ownership of the chain.
+  /// @threadsafe
+  inbox_result push_front_chain(pointer first, pointer last) noexcept {
+    CAF_ASSERT(first != nullptr);
+    CAF_ASSERT(last != nullptr);
+    pointer e = stack_.load();
+    auto eof = stack_closed_tag();
+    auto blk = reader_blocked_tag();
+    while (e != eof) {
+      // A tag is never part of a non-empty list.
+      last->next = e != blk ? e : nullptr;
+      if (stack_.compare_exchange_strong(e, first))
+        return e == reader_blocked_tag() ? inbox_result::unblocked_reader
+                                         : inbox_result::success;
+      // Continue with new value of `e`.
+    }
+    last->next = nullptr;
+    return inbox_result::queue_closed;
+  }
+
   /// Tries to enqueue a new element to the mailbox.
   /// @threadsafe
   template <class... Ts>
@@ -261,7 +285,11 @@ private:
 
   // -- member variables ------------------------------------------------------
 
-  std::atomic<pointer> stack_;
+  // Producers on other threads CAS the head of the stack while the owner of
+  // the inbox usually writes to the surrounding object. Aligning the head
+  // gives it a cache line of its own, i.e., sizeof(lifo_inbox) is always a
+  // full cache line and neighboring members cannot cause false sharing.
+  alignas(CAF_CACHE_LINE_SIZE) std::atomic<pointer> stack_;
 };
 
 } // namespace caf::intrusive
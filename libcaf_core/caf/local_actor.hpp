@@ -10,6 +10,7 @@
 #include <functional>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "caf/abstract_actor.hpp"
 #include "caf/abstract_group.hpp"
@@ -61,6 +62,21 @@ public:
 
     /// Counts how many messages are currently waiting in the mailbox.
     telemetry::int_gauge* mailbox_size = nullptr;
+
+    /// Counts how many messages the actor discarded due to a full mailbox.
+    telemetry::int_counter* mailbox_drops = nullptr;
+
+    /// Counts how often the actor exceeded its time budget per run.
+    telemetry::int_counter* time_slice_overruns = nullptr;
+
+    /// Counts how many actors currently hibernate.
+    telemetry::int_gauge* hibernating_actors = nullptr;
+
+    /// Counts how many bytes hibernating actors use for their serialized state.
+    telemetry::int_gauge* hibernated_bytes = nullptr;
+
+    /// Samples how long the actor needs to restore its state after hibernating.
+    telemetry::dbl_histogram* wakeup_time = nullptr;
   };
 
   /// Optional metrics for inbound stream traffic collected by individual actors
@@ -112,6 +128,10 @@ public:
   /// @pre `mid.is_request()`
   void request_response_timeout(timespan d, message_id mid);
 
+  /// Requests a single timeout for the group of response IDs `ids`.
+  /// @pre `!ids.empty()`
+  void request_response_timeout(timespan d, std::vector<message_id> ids);
+
   // -- spawn functions --------------------------------------------------------
 
   template <class T, spawn_options Os = no_spawn_options, class... Ts>
@@ -417,6 +437,15 @@ public:
 
   virtual void initialize();
 
+  /// Serializes the state of the actor to `buf` and destroys it afterwards.
+  /// Returns `false` if the actor cannot restore its state later, in which case
+  /// it keeps the state. The default implementation always returns `false`.
+  virtual bool hibernate_state(byte_buffer& buf);
+
+  /// Restores the state of the actor from `buf` after a successful call to
+  /// `hibernate_state`.
+  virtual error wake_up_state(const byte_buffer& buf);
+
   bool cleanup(error&& fail_state, execution_unit* host) override;
 
   message_id new_request_id(message_priority mp);
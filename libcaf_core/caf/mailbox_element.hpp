@@ -7,12 +7,16 @@
 #include <chrono>
 #include <cstddef>
 #include <memory>
+#include <new>
 
 #include "caf/actor_control_block.hpp"
 #include "caf/detail/core_export.hpp"
+#include "caf/detail/memory_pool.hpp"
+#include "caf/detail/scope_guard.hpp"
 #include "caf/intrusive/singly_linked.hpp"
 #include "caf/message.hpp"
 #include "caf/message_id.hpp"
+#include "caf/raise_error.hpp"
 #include "caf/tracing_data.hpp"
 
 namespace caf {
@@ -77,6 +81,19 @@ public:
   mailbox_element& operator=(mailbox_element&&) = delete;
   mailbox_element& operator=(const mailbox_element&) = delete;
 
+  // -- memory management ------------------------------------------------------
+
+  /// Allocates mailbox elements from the @ref detail::memory_pool.
+  static void* operator new(size_t size) {
+    if (auto ptr = detail::memory_pool::allocate(size))
+      return ptr;
+    CAF_RAISE_ERROR(std::bad_alloc, "bad_alloc");
+  }
+
+  static void operator delete(void* ptr) noexcept {
+    detail::memory_pool::deallocate(ptr);
+  }
+
   // -- backward compatibility -------------------------------------------------
 
   message& content() noexcept {
@@ -107,6 +124,20 @@ CAF_CORE_EXPORT mailbox_element_ptr
 make_mailbox_element(strong_actor_ptr sender, message_id id,
                      mailbox_element::forwarding_stack stages, message content);
 
+/// Number of bytes for the mailbox element and the inline message data when
+/// co-allocating both for the message elements `Ts`.
+/// @relates mailbox_element
+template <class... Ts>
+constexpr size_t inline_mailbox_element_size
+  = detail::memory_pool::pair_offset(sizeof(mailbox_element))
+    + sizeof(detail::message_data)
+    + (detail::padded_size_v<detail::strip_and_convert_t<Ts>> + ...);
+
+/// Creates a mailbox element for the message elements `x, xs...`. Small
+/// payloads live in the same memory block as the mailbox element, i.e., this
+/// function only allocates once. The message data remains valid after
+/// destroying the mailbox element, since the block only returns to the
+/// @ref detail::memory_pool after releasing both.
 /// @relates mailbox_element
 template <class T, class... Ts>
 std::enable_if_t<!std::is_same<typename std::decay<T>::type, message>::value
@@ -115,9 +146,38 @@ std::enable_if_t<!std::is_same<typename std::decay<T>::type, message>::value
 make_mailbox_element(strong_actor_ptr sender, message_id id,
                      mailbox_element::forwarding_stack stages, T&& x,
                      Ts&&... xs) {
-  return make_mailbox_element(std::move(sender), id, std::move(stages),
-                              make_message(std::forward<T>(x),
-                                           std::forward<Ts>(xs)...));
+  if constexpr (inline_mailbox_element_size<T, Ts...>
+                <= detail::memory_pool::max_pooled_size) {
+    using namespace detail;
+    static_assert(!std::is_pointer<strip_and_convert_t<T>>::value
+                  && (!std::is_pointer<strip_and_convert_t<Ts>>::value && ...));
+    static_assert(is_complete<type_id<strip_and_convert_t<T>>>
+                  && (is_complete<type_id<strip_and_convert_t<Ts>>> && ...));
+    static constexpr size_t data_size
+      = inline_mailbox_element_size<T, Ts...>
+        - memory_pool::pair_offset(sizeof(mailbox_element));
+    auto types = make_type_id_list<strip_and_convert_t<T>,
+                                   strip_and_convert_t<Ts>...>();
+    void* data_ptr = nullptr;
+    auto vptr = memory_pool::allocate_pair(sizeof(mailbox_element), data_size,
+                                           data_ptr);
+    if (vptr == nullptr)
+      CAF_RAISE_ERROR(std::bad_alloc, "bad_alloc");
+    // Releases our share of the block if initializing the content throws.
+    auto guard = make_scope_guard([vptr] { memory_pool::deallocate(vptr); });
+    auto raw_ptr = new (data_ptr) message_data(types);
+    intrusive_cow_ptr<message_data> ptr{raw_ptr, false};
+    raw_ptr->init(std::forward<T>(x), std::forward<Ts>(xs)...);
+    auto result = ::new (vptr) mailbox_element(std::move(sender), id,
+                                               std::move(stages),
+                                               message{std::move(ptr)});
+    guard.disable();
+    return mailbox_element_ptr{result};
+  } else {
+    return make_mailbox_element(std::move(sender), id, std::move(stages),
+                                make_message(std::forward<T>(x),
+                                             std::forward<Ts>(xs)...));
+  }
 }
 
 } // namespace caf
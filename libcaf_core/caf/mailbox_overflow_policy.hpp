@@ -0,0 +1,39 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/master/LICENSE.
+
+#pragma once
+
+#include <string>
+
+#include "caf/detail/core_export.hpp"
+
+namespace caf {
+
+/// Configures how an actor with a bounded mailbox reacts to messages that
+/// arrive while the mailbox is full. Only asynchronous messages and requests
+/// count towards the capacity. System messages such as `exit_msg` as well as
+/// responses and stream traffic always bypass the limit.
+enum class mailbox_overflow_policy {
+  /// Discards the new message. Requests receive `sec::mailbox_full`.
+  drop_newest,
+
+  /// Accepts the new message but discards the oldest message in the mailbox.
+  /// The actor drops excess messages before processing its mailbox, i.e., the
+  /// mailbox may exceed its capacity temporarily. Dropped requests receive
+  /// `sec::mailbox_full`.
+  drop_oldest,
+
+  /// Discards the new message and sends `sec::mailbox_full` to the sender,
+  /// either as response to a request or as asynchronous error message that
+  /// ends up in the error handler of the sender.
+  reject,
+
+  /// Accepts all messages but reports congestion to senders via
+  /// `abstract_actor::mailbox_congested` while the mailbox is full.
+  backoff,
+};
+
+CAF_CORE_EXPORT std::string to_string(mailbox_overflow_policy);
+
+} // namespace caf
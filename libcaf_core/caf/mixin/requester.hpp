@@ -86,7 +86,9 @@ public:
   /// @param destinations A container holding handles to all destination actors.
   /// @param timeout Maximum duration before dropping the request. The runtime
   ///                system will send an error message to the actor in case the
-  ///                receiver does not respond in time.
+  ///                receiver does not respond in time. All requests share a
+  ///                single timeout, which the actor cancels after receiving
+  ///                all responses when using `.await()` or `.then()`.
   /// @returns A helper object that takes response handlers via `.await()`,
   ///          `.then()`, or `.receive()`.
   /// @note The returned handle is actor-specific. Only the actor that called
@@ -112,9 +114,12 @@ public:
       auto req_id = dptr->new_request_id(Prio);
       dest->eq_impl(req_id, dptr->ctrl(), dptr->context(),
                     std::forward<Ts>(xs)...);
-      dptr->request_response_timeout(timeout, req_id);
       ids.emplace_back(req_id.response_id());
     }
+    if (ids.size() == 1)
+      dptr->request_response_timeout(timeout, ids.front());
+    else if (ids.size() > 1)
+      dptr->request_response_timeout(timeout, ids);
     if (ids.empty()) {
       auto req_id = dptr->new_request_id(Prio);
       dptr->eq_impl(req_id.response_id(), dptr->ctrl(), dptr->context(),
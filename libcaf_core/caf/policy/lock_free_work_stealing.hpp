@@ -0,0 +1,102 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/master/LICENSE.
+
+#pragma once
+
+#include "caf/detail/core_export.hpp"
+#include "caf/detail/work_stealing_deque.hpp"
+#include "caf/policy/work_stealing.hpp"
+#include "caf/resumable.hpp"
+
+namespace caf::policy {
+
+/// Implements scheduling of actors via work stealing, but unlike
+/// `work_stealing` keeps jobs enqueued by the worker itself in a lock-free
+/// Chase-Lev deque. The owner pushes and pops at the bottom of the deque
+/// without allocating, while thieves take the oldest job from its top via CAS.
+/// Jobs enqueued from other threads still go through the (locked) queue of the
+/// base policy, since the deque only supports a single producer.
+/// @extends scheduler_policy
+class CAF_CORE_EXPORT lock_free_work_stealing : public work_stealing {
+public:
+  ~lock_free_work_stealing() override;
+
+  // A lock-free queue implementation for jobs of the worker itself.
+  using local_queue_type = detail::work_stealing_deque<resumable>;
+
+  // Extends the worker data of the base policy by the owner-local deque. The
+  // inherited `queue` member receives jobs from other threads.
+  struct worker_data : work_stealing::worker_data {
+    explicit worker_data(scheduler::abstract_coordinator* p);
+    worker_data(const worker_data& other);
+
+    // Jobs enqueued by the worker itself. Only the worker pushes and pops at
+    // the bottom, other workers may steal from the top.
+    local_queue_type local_queue;
+  };
+
+  template <class Worker>
+  resumable* try_steal(Worker* self) {
+    // prefer the lock-free path and only fall back to the locked queue if the
+    // victim has no local jobs
+    return raid(self, [self](Worker* victim) {
+      auto& vd = d(victim);
+      auto& sd = d(self);
+      if (auto job = vd.local_queue.steal()) {
+        if (sd.batch_steal) {
+          // the deque only allows taking one element per CAS, so we steal the
+          // remaining batch one by one (up to half of the victim's jobs)
+          for (auto n = vd.local_queue.size() / 2; n > 0; --n) {
+            auto extra = vd.local_queue.steal();
+            if (extra == nullptr)
+              break;
+            sd.local_queue.push_bottom(extra);
+          }
+        }
+        return job;
+      }
+      if (sd.batch_steal)
+        return vd.queue.take_tail_half(sd.queue);
+      return vd.queue.take_tail();
+    });
+  }
+
+  template <class Worker>
+  void internal_enqueue(Worker* self, resumable* job) {
+    d(self).local_queue.push_bottom(job);
+  }
+
+  template <class Worker>
+  void resume_job_later(Worker* self, resumable* job) {
+    // the local deque is LIFO for the owner, so we put this job at the end of
+    // the shared queue instead to give all other jobs a chance to run first
+    d(self).queue.append(job);
+  }
+
+  template <class Worker>
+  resumable* take_local(Worker* self) {
+    if (auto job = d(self).local_queue.pop_bottom())
+      return job;
+    return d(self).queue.take_head();
+  }
+
+  template <class Worker>
+  resumable* dequeue(Worker* self) {
+    // our local deque remains empty while parked, since only the worker itself
+    // pushes to it, i.e., other threads wake us up via the base queue
+    return dequeue_impl(
+      self, [this, self] { return take_local(self); },
+      [this, self] { return try_steal(self); });
+  }
+
+  template <class Worker, class UnaryFunction>
+  void foreach_resumable(Worker* self, UnaryFunction f) {
+    auto next = [&] { return take_local(self); };
+    for (auto job = next(); job != nullptr; job = next()) {
+      f(job);
+    }
+  }
+};
+
+} // namespace caf::policy
@@ -14,6 +14,11 @@ namespace caf::policy {
 /// and coordinator of the scheduler.
 class CAF_CORE_EXPORT scheduler_policy {
 public:
+  /// Signals whether `dequeue` calls `Worker::trigger_timers` while waiting
+  /// for jobs and never waits longer than `Worker::max_park_duration`.
+  /// Workers own a local timer shard only if the policy supports it.
+  static constexpr bool supports_worker_timers = false;
+
   /// Policy-specific data fields for the coordinator.
   struct coordinator_data {
     explicit coordinator_data(scheduler::abstract_coordinator*);
@@ -47,6 +52,11 @@ public:
   template <class Worker>
   resumable* dequeue(Worker* self);
 
+  /// Performs initialization steps on the thread of the worker before it
+  /// dequeues its first job.
+  template <class Worker>
+  void init_worker(Worker* self);
+
   /// Performs cleanup action before a shutdown takes place.
   template <class Worker>
   void before_shutdown(Worker* self);
@@ -13,6 +13,7 @@
 #include "caf/behavior.hpp"
 #include "caf/config.hpp"
 #include "caf/detail/type_list.hpp"
+#include "caf/detail/request_group_guard.hpp"
 #include "caf/detail/type_traits.hpp"
 #include "caf/detail/typed_actor_util.hpp"
 #include "caf/error.hpp"
@@ -125,7 +126,8 @@ public:
   template <class Self, class F, class OnError>
   void await(Self* self, F&& f, OnError&& g) const {
     CAF_LOG_TRACE(CAF_ARG(ids_));
-    auto bhvr = make_behavior(std::forward<F>(f), std::forward<OnError>(g));
+    auto bhvr = make_behavior(std::forward<F>(f), std::forward<OnError>(g),
+                              detail::make_request_group_guard(self, ids_));
     for (auto id : ids_)
       self->add_awaited_response_handler(id, bhvr);
   }
@@ -133,7 +135,8 @@ public:
   template <class Self, class F, class OnError>
   void then(Self* self, F&& f, OnError&& g) const {
     CAF_LOG_TRACE(CAF_ARG(ids_));
-    auto bhvr = make_behavior(std::forward<F>(f), std::forward<OnError>(g));
+    auto bhvr = make_behavior(std::forward<F>(f), std::forward<OnError>(g),
+                              detail::make_request_group_guard(self, ids_));
     for (auto id : ids_)
       self->add_multiplexed_response_handler(id, bhvr);
   }
@@ -163,13 +166,16 @@ public:
 
 private:
   template <class F, class OnError>
-  behavior make_behavior(F&& f, OnError&& g) const {
+  behavior make_behavior(F&& f, OnError&& g,
+                         detail::request_group_guard_ptr guard) const {
     using namespace detail;
     using helper_type = select_all_helper_t<decay_t<F>>;
     helper_type helper{ids_.size(), std::move(f)};
     auto pending = helper.pending;
+    // The guard cancels the shared timeout after receiving all responses.
     auto error_handler = [pending{std::move(pending)},
-                          g{std::forward<OnError>(g)}](error& err) mutable {
+                          g{std::forward<OnError>(g)},
+                          guard{std::move(guard)}](error& err) mutable {
       CAF_LOG_TRACE(CAF_ARG2("pending", *pending));
       if (*pending > 0) {
         *pending = 0;
@@ -10,6 +10,7 @@
 #include "caf/behavior.hpp"
 #include "caf/config.hpp"
 #include "caf/detail/type_list.hpp"
+#include "caf/detail/request_group_guard.hpp"
 #include "caf/detail/type_traits.hpp"
 #include "caf/detail/typed_actor_util.hpp"
 #include "caf/logger.hpp"
@@ -62,7 +63,8 @@ public:
   template <class Self, class F, class OnError>
   void await(Self* self, F&& f, OnError&& g) const {
     CAF_LOG_TRACE(CAF_ARG(ids_));
-    auto bhvr = make_behavior(std::forward<F>(f), std::forward<OnError>(g));
+    auto bhvr = make_behavior(std::forward<F>(f), std::forward<OnError>(g),
+                              detail::make_request_group_guard(self, ids_));
     for (auto id : ids_)
       self->add_awaited_response_handler(id, bhvr);
   }
@@ -70,7 +72,8 @@ public:
   template <class Self, class F, class OnError>
   void then(Self* self, F&& f, OnError&& g) const {
     CAF_LOG_TRACE(CAF_ARG(ids_));
-    auto bhvr = make_behavior(std::forward<F>(f), std::forward<OnError>(g));
+    auto bhvr = make_behavior(std::forward<F>(f), std::forward<OnError>(g),
+                              detail::make_request_group_guard(self, ids_));
     for (auto id : ids_)
       self->add_multiplexed_response_handler(id, bhvr);
   }
@@ -96,8 +99,11 @@ public:
 
 private:
   template <class OnError>
-  auto make_error_handler(std::shared_ptr<size_t> p, OnError&& g) const {
-    return [p{std::move(p)}, g{std::forward<OnError>(g)}](error&) mutable {
+  auto make_error_handler(std::shared_ptr<size_t> p, OnError&& g,
+                          detail::request_group_guard_ptr guard
+                          = nullptr) const {
+    return [p{std::move(p)}, g{std::forward<OnError>(g)},
+            guard{std::move(guard)}](error&) mutable {
       if (*p == 0) {
         // nop
       } else if (*p == 1) {
@@ -110,13 +116,16 @@ private:
   }
 
   template <class F, class OnError>
-  behavior make_behavior(F&& f, OnError&& g) const {
+  behavior make_behavior(F&& f, OnError&& g,
+                         detail::request_group_guard_ptr guard) const {
     using factory = detail::select_any_factory<std::decay_t<F>>;
     auto pending = std::make_shared<size_t>(ids_.size());
     auto result_handler = factory::make(pending, std::forward<F>(f));
+    // The guard cancels the shared timeout after receiving all responses.
     return {
       std::move(result_handler),
-      make_error_handler(std::move(pending), std::forward<OnError>(g)),
+      make_error_handler(std::move(pending), std::forward<OnError>(g),
+                         std::move(guard)),
     };
   }
 
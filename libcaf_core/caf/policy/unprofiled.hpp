@@ -18,6 +18,13 @@ class CAF_CORE_EXPORT unprofiled {
 public:
   virtual ~unprofiled();
 
+  /// Performs initialization steps on the thread of the worker before it
+  /// dequeues its first job.
+  template <class Worker>
+  void init_worker(Worker*) {
+    // nop
+  }
+
   /// Performs cleanup action before a shutdown takes place.
   template <class Worker>
   void before_shutdown(Worker*) {
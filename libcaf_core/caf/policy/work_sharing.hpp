@@ -19,6 +19,9 @@ namespace caf::policy {
 /// @extends scheduler_policy
 class CAF_CORE_EXPORT work_sharing : public unprofiled {
 public:
+  // Workers block on a condition variable while waiting for jobs.
+  static constexpr bool supports_worker_timers = false;
+
   // A thread-safe queue implementation.
   using queue_type = std::list<resumable*>;
 
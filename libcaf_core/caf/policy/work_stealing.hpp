@@ -6,18 +6,19 @@
 
 #include <array>
 #include <chrono>
-#include <condition_variable>
 #include <cstddef>
 #include <deque>
-#include <mutex>
+#include <memory>
 #include <random>
-#include <thread>
 
 #include "caf/actor_system_config.hpp"
 #include "caf/detail/core_export.hpp"
+#include "caf/detail/cpu_topology.hpp"
 #include "caf/detail/double_ended_queue.hpp"
+#include "caf/detail/event_count.hpp"
 #include "caf/policy/unprofiled.hpp"
 #include "caf/resumable.hpp"
+#include "caf/telemetry/counter.hpp"
 #include "caf/timespan.hpp"
 
 namespace caf::policy {
@@ -26,6 +27,9 @@ namespace caf::policy {
 /// @extends scheduler_policy
 class CAF_CORE_EXPORT work_stealing : public unprofiled {
 public:
+  // Workers check their timers between polling attempts.
+  static constexpr bool supports_worker_timers = true;
+
   ~work_stealing() override;
 
   // A thread-safe queue implementation.
@@ -41,9 +45,10 @@ public:
 
   // what is needed to implement the waiting strategy.
   struct wait_strategy {
-    std::mutex lock;
-    std::condition_variable cv;
-    bool sleeping{false};
+    // allows other threads to wake up the worker while it is parked
+    detail::event_count parked;
+    // moving average of the time the worker spent idle before a job arrived
+    timespan avg_idle{0};
   };
 
   // The coordinator has only a counter for round-robin enqueue to its workers.
@@ -56,6 +61,32 @@ public:
     std::atomic<size_t> next_worker;
   };
 
+  // Locality of a victim relative to the thief.
+  enum locality_level : size_t {
+    same_cache,
+    same_node,
+    remote,
+    num_locality_levels,
+  };
+
+  // Maps workers to CPUs and groups potential victims by their locality. All
+  // workers share one instance.
+  struct topology_data {
+    // Stores the CPU for each worker (indexed by worker ID).
+    std::vector<int> cpus;
+    // Stores the victims for each worker grouped by locality level. Remains
+    // empty unless topology-aware stealing is enabled.
+    std::vector<std::array<std::vector<size_t>, num_locality_levels>> victims;
+    // Counts successful steals per locality level. Only available with
+    // topology-aware stealing.
+    std::array<telemetry::int_counter*, num_locality_levels> steals{};
+  };
+
+  // Discovers the CPU topology if pinning or topology-aware stealing is
+  // enabled in the config, returns `nullptr` otherwise.
+  static std::shared_ptr<const topology_data>
+  make_topology_data(scheduler::abstract_coordinator* p);
+
   // Holds job job queue of a worker and a random number generator.
   struct worker_data {
     explicit worker_data(scheduler::abstract_coordinator* p);
@@ -69,22 +100,64 @@ public:
     std::uniform_int_distribution<size_t> uniform;
     std::array<poll_strategy, 3> strategies;
     wait_strategy waitdata;
+    // whether thieves take up to half of the victim's queue
+    bool batch_steal;
+    // CPU pinning and victim selection, `nullptr` if disabled.
+    std::shared_ptr<const topology_data> topology;
   };
 
-  // Goes on a raid in quest for a shiny new job.
+  // Pins the worker to its CPU if configured.
   template <class Worker>
-  resumable* try_steal(Worker* self) {
+  void init_worker(Worker* self) {
+    if (auto& topology = d(self).topology)
+      detail::pin_this_thread(topology->cpus[self->id()]);
+  }
+
+  // Picks one or more victims and calls `steal_from` on each one until
+  // stealing a job succeeds. Prefers victims close to `self` when using
+  // topology-aware stealing, otherwise picks a single victim at random.
+  template <class Worker, class StealFunction>
+  resumable* raid(Worker* self, StealFunction steal_from) {
     auto p = self->parent();
     if (p->num_workers() < 2) {
       // you can't steal from yourself, can you?
       return nullptr;
     }
-    // roll the dice to pick a victim other than ourselves
-    auto victim = d(self).uniform(d(self).rengine);
-    if (victim == self->id())
-      victim = p->num_workers() - 1;
-    // steal oldest element from the victim's queue
-    return d(p->worker_by_id(victim)).queue.take_tail();
+    auto& topology = d(self).topology;
+    if (!topology || topology->victims.empty()) {
+      // roll the dice to pick a victim other than ourselves
+      auto victim = d(self).uniform(d(self).rengine);
+      if (victim == self->id())
+        victim = p->num_workers() - 1;
+      return steal_from(p->worker_by_id(victim));
+    }
+    // try one random victim per locality level, starting with the closest
+    auto& levels = topology->victims[self->id()];
+    for (size_t lvl = 0; lvl < num_locality_levels; ++lvl) {
+      auto& candidates = levels[lvl];
+      if (candidates.empty())
+        continue;
+      auto victim = candidates[d(self).rengine() % candidates.size()];
+      if (auto job = steal_from(p->worker_by_id(victim))) {
+        topology->steals[lvl]->inc();
+        return job;
+      }
+    }
+    return nullptr;
+  }
+
+  // Goes on a raid in quest for a shiny new job.
+  template <class Worker>
+  resumable* try_steal(Worker* self) {
+    // steal oldest element from the victim's queue, optionally moving up to
+    // half of the victim's queue to our own queue in the same operation
+    if (d(self).batch_steal)
+      return raid(self, [self](Worker* victim) {
+        return d(victim).queue.take_tail_half(d(self).queue);
+      });
+    return raid(self, [](Worker* victim) { //
+      return d(victim).queue.take_tail();
+    });
   }
 
   template <class Coordinator>
@@ -96,14 +169,8 @@ public:
   template <class Worker>
   void external_enqueue(Worker* self, resumable* job) {
     d(self).queue.append(job);
-    auto& lock = d(self).waitdata.lock;
-    auto& cv = d(self).waitdata.cv;
-    { // guard scope
-      std::unique_lock<std::mutex> guard(lock);
-      // check if the worker is sleeping
-      if (d(self).waitdata.sleeping && !d(self).queue.empty())
-        cv.notify_one();
-    }
+    // only pays for a wakeup if the worker is actually parked
+    d(self).waitdata.parked.notify_one();
   }
 
   template <class Worker>
@@ -118,69 +185,91 @@ public:
     d(self).queue.append(job);
   }
 
+  // Blocks the worker until another thread enqueues a job to its queue or
+  // until `timeout` expires.
   template <class Worker>
-  resumable* dequeue(Worker* self) {
-    // we wait for new jobs by polling our external queue: first, we
-    // assume an active work load on the machine and perform aggressive
-    // polling, then we relax our polling a bit and wait 50 us between
-    // dequeue attempts
+  void park(Worker* self, timespan timeout) {
+    auto& parked = d(self).waitdata.parked;
+    auto key = parked.prepare_wait();
+    // re-check the queue after announcing ourselves to not miss a wakeup
+    if (!d(self).queue.empty())
+      parked.cancel_wait();
+    else
+      parked.wait_for(key, timeout);
+  }
+
+  // Waits for a new job by calling `take` for fetching a job from our own
+  // queue and `steal` for fetching a job from other workers.
+  template <class Worker, class Take, class Steal>
+  resumable* dequeue_impl(Worker* self, Take take_job, Steal steal) {
+    // ship expired timers of the worker before polling its queue, since the
+    // receivers end up in that queue
+    auto take = [self, &take_job] {
+      self->trigger_timers();
+      return take_job();
+    };
+    if (auto job = take())
+      return job;
+    using clock_type = std::chrono::steady_clock;
     auto& strategies = d(self).strategies;
-    resumable* job = nullptr;
-    for (size_t k = 0; k < 2; ++k) { // iterate over the first two strategies
-      for (size_t i = 0; i < strategies[k].attempts;
-           i += strategies[k].step_size) {
-        job = d(self).queue.take_head();
-        if (job)
-          return job;
-        // try to steal every X poll attempts
-        if ((i % strategies[k].steal_interval) == 0) {
-          job = try_steal(self);
-          if (job)
-            return job;
-        }
-        if (strategies[k].sleep_duration.count() > 0) {
-#ifdef CAF_MSVC
-          // Windows cannot sleep less than 1000 us, so timeout is converted to
-          // 0 inside sleep_for(), but Sleep(0) is dangerous so replace it with
-          // yield()
-          if (strategies[k].sleep_duration.count() < 1000)
-            std::this_thread::yield();
-          else
-            std::this_thread::sleep_for(strategies[k].sleep_duration);
-#else
-          std::this_thread::sleep_for(strategies[k].sleep_duration);
-#endif
-        }
+    auto& waitdata = d(self).waitdata;
+    auto idle_start = clock_type::now();
+    auto idle_time = [&] {
+      using std::chrono::duration_cast;
+      return duration_cast<timespan>(clock_type::now() - idle_start);
+    };
+    auto found = [&](resumable* job) {
+      // update the moving average of our idle time with alpha = 1/8
+      waitdata.avg_idle += (idle_time() - waitdata.avg_idle) / 8;
+      return job;
+    };
+    // first, we assume an active work load on the machine and perform
+    // aggressive polling, but only as long as jobs recently arrived faster
+    // than a moderate sleep duration: spinning is a waste of CPU time when
+    // jobs arrive less frequently
+    auto& aggressive = strategies[0];
+    auto& moderate = strategies[1];
+    auto spin_budget = waitdata.avg_idle <= moderate.sleep_duration
+                         ? 2 * waitdata.avg_idle
+                         : timespan{0};
+    for (size_t i = 0; i < aggressive.attempts; i += aggressive.step_size) {
+      if (auto job = take())
+        return found(job);
+      // try to steal every X poll attempts
+      if ((i % aggressive.steal_interval) == 0) {
+        if (auto job = steal())
+          return found(job);
+        if (idle_time() > spin_budget)
+          break;
       }
     }
-    // we assume pretty much nothing is going on so we can relax polling
-    // and falling to sleep on a condition variable whose timeout is the one
-    // of the relaxed polling strategy
+    // then we park between dequeue attempts, first for the moderate and then
+    // for the relaxed sleep duration; unlike sleeping, a parked worker wakes
+    // up immediately when receiving a new job from another thread
+    for (size_t i = 0; i < moderate.attempts; i += moderate.step_size) {
+      park(self, self->max_park_duration(moderate.sleep_duration));
+      if (auto job = take())
+        return found(job);
+      if ((i % moderate.steal_interval) == 0)
+        if (auto job = steal())
+          return found(job);
+    }
     auto& relaxed = strategies[2];
-    auto& sleeping = d(self).waitdata.sleeping;
-    auto& lock = d(self).waitdata.lock;
-    auto& cv = d(self).waitdata.cv;
-    bool notimeout = true;
-    size_t i = 1;
-    do {
-      { // guard scope
-        std::unique_lock<std::mutex> guard(lock);
-        sleeping = true;
-        if (!cv.wait_for(guard, relaxed.sleep_duration,
-                         [&] { return !d(self).queue.empty(); }))
-          notimeout = false;
-        sleeping = false;
-      }
-      if (notimeout) {
-        job = d(self).queue.take_head();
-      } else {
-        notimeout = true;
-        if ((i % relaxed.steal_interval) == 0)
-          job = try_steal(self);
-      }
-      ++i;
-    } while (job == nullptr);
-    return job;
+    for (size_t i = 1;; ++i) {
+      park(self, self->max_park_duration(relaxed.sleep_duration));
+      if (auto job = take())
+        return found(job);
+      if ((i % relaxed.steal_interval) == 0)
+        if (auto job = steal())
+          return found(job);
+    }
+  }
+
+  template <class Worker>
+  resumable* dequeue(Worker* self) {
+    return dequeue_impl(
+      self, [self] { return d(self).queue.take_head(); },
+      [this, self] { return try_steal(self); });
   }
 
   template <class Worker, class UnaryFunction>
@@ -10,15 +10,18 @@
 #  include <exception>
 #endif // CAF_ENABLE_EXCEPTIONS
 
+#include <atomic>
 #include <forward_list>
 #include <map>
+#include <memory>
 #include <type_traits>
 #include <unordered_map>
 
 #include "caf/actor_traits.hpp"
+#include "caf/byte_buffer.hpp"
 #include "caf/detail/behavior_stack.hpp"
 #include "caf/detail/core_export.hpp"
-#include "caf/detail/unordered_flat_map.hpp"
+#include "caf/detail/response_handler_table.hpp"
 #include "caf/error.hpp"
 #include "caf/extend.hpp"
 #include "caf/fwd.hpp"
@@ -31,6 +34,7 @@
 #include "caf/invoke_message_result.hpp"
 #include "caf/local_actor.hpp"
 #include "caf/logger.hpp"
+#include "caf/mailbox_overflow_policy.hpp"
 #include "caf/mixin/behavior_changer.hpp"
 #include "caf/mixin/requester.hpp"
 #include "caf/mixin/sender.hpp"
@@ -184,6 +188,44 @@ public:
   using exception_handler = std::function<error(pointer, std::exception_ptr&)>;
 #endif // CAF_ENABLE_EXCEPTIONS
 
+  /// Stores members that most actors never touch. Actors allocate this block
+  /// on first use only, which keeps the footprint of idle actors small.
+  struct cold_state {
+    cold_state();
+
+    /// Customization point for setting a default `message` callback.
+    default_handler default_fun;
+
+    /// Customization point for setting a default `error` callback.
+    error_handler error_fun;
+
+    /// Customization point for setting a default `down_msg` callback.
+    down_handler down_fun;
+
+    /// Customization point for setting a default `node_down_msg` callback.
+    node_down_handler node_down_fun;
+
+    /// Customization point for setting a default `exit_msg` callback.
+    exit_handler exit_fun;
+
+#ifdef CAF_ENABLE_EXCEPTIONS
+    /// Customization point for setting a default exception callback.
+    exception_handler exception_fun;
+#endif // CAF_ENABLE_EXCEPTIONS
+
+    /// Caches metric objects for inbound stream traffic.
+    inbound_stream_metrics_map inbound_stream_metrics;
+
+    /// Caches metric objects for outbound stream traffic.
+    outbound_stream_metrics_map outbound_stream_metrics;
+
+    /// Identifies the hibernation timeout we are currently waiting for.
+    uint64_t hibernation_timeout_id = 0;
+
+    /// Stores the serialized state of a hibernating actor.
+    byte_buffer hibernated_state;
+  };
+
   // -- static helper functions ------------------------------------------------
 
   static void default_error_handler(pointer ptr, error& x);
@@ -219,10 +261,16 @@ public:
 
   void enqueue(mailbox_element_ptr ptr, execution_unit* eu) override;
 
+  void enqueue_batch(mailbox_element_ptr first, execution_unit* eu) override;
+
   mailbox_element* peek_at_next_mailbox_element() override;
 
+  bool mailbox_congested() const noexcept override;
+
   // -- overridden functions of local_actor ------------------------------------
 
+  void on_destroy() override;
+
   const char* name() const override;
 
   void launch(execution_unit* eu, bool lazy, bool hide) override;
@@ -266,6 +314,17 @@ public:
     return mailbox_;
   }
 
+  /// Returns the maximum number of asynchronous messages in the mailbox or 0
+  /// if the mailbox is unbounded.
+  size_t mailbox_capacity() const noexcept {
+    return mailbox_capacity_;
+  }
+
+  /// Returns how the actor handles messages that exceed its capacity.
+  mailbox_overflow_policy overflow_policy() const noexcept {
+    return overflow_policy_;
+  }
+
   /// Returns map for all active streams.
   stream_manager_map& stream_managers() noexcept {
     return stream_managers_;
@@ -276,6 +335,22 @@ public:
     return pending_stream_managers_;
   }
 
+  // -- hibernation ------------------------------------------------------------
+
+  /// Lets the actor hibernate after processing no message for `idle_time`. A
+  /// hibernating actor releases its caches and, for stateful actors with an
+  /// `inspect` overload for their state, serializes its state into a compact
+  /// buffer. The next message wakes up the actor again. Passing `infinite`
+  /// disables hibernation.
+  /// @note Actors that await responses or participate in streams never
+  ///       hibernate.
+  void hibernate_after(timespan idle_time);
+
+  /// Returns whether the actor currently hibernates.
+  bool hibernating() const noexcept {
+    return hibernating_;
+  }
+
   // -- actor metrics ----------------------------------------------------------
 
   inbound_stream_metrics_t inbound_stream_metrics(type_id_t type);
@@ -287,9 +362,9 @@ public:
   /// Sets a custom handler for unexpected messages.
   void set_default_handler(default_handler fun) {
     if (fun)
-      default_handler_ = std::move(fun);
+      cold().default_fun = std::move(fun);
     else
-      default_handler_ = print_and_drop;
+      cold().default_fun = print_and_drop;
   }
 
   /// Sets a custom handler for unexpected messages.
@@ -297,7 +372,8 @@ public:
   std::enable_if_t<std::is_invocable_r_v<skippable_result, F, message&>>
   set_default_handler(F fun) {
     using std::move;
-    default_handler_ = [fn{move(fun)}](scheduled_actor*, message& xs) mutable {
+    cold().default_fun = [fn{move(fun)}](scheduled_actor*,
+                                         message& xs) mutable {
       return fn(xs);
     };
   }
@@ -305,15 +381,16 @@ public:
   /// Sets a custom handler for error messages.
   void set_error_handler(error_handler fun) {
     if (fun)
-      error_handler_ = std::move(fun);
+      cold().error_fun = std::move(fun);
     else
-      error_handler_ = default_error_handler;
+      cold().error_fun = default_error_handler;
   }
 
   /// Sets a custom handler for error messages.
   template <class F>
   std::enable_if_t<std::is_invocable_v<F, error&>> set_error_handler(F fun) {
-    error_handler_ = [fn{std::move(fun)}](scheduled_actor*, error& x) mutable {
+    cold().error_fun = [fn{std::move(fun)}](scheduled_actor*,
+                                            error& x) mutable {
       fn(x);
     };
   }
@@ -321,16 +398,16 @@ public:
   /// Sets a custom handler for down messages.
   void set_down_handler(down_handler fun) {
     if (fun)
-      down_handler_ = std::move(fun);
+      cold().down_fun = std::move(fun);
     else
-      down_handler_ = default_down_handler;
+      cold().down_fun = default_down_handler;
   }
 
   /// Sets a custom handler for down messages.
   template <class F>
   std::enable_if_t<std::is_invocable_v<F, down_msg&>> set_down_handler(F fun) {
     using std::move;
-    down_handler_ = [fn{move(fun)}](scheduled_actor*, down_msg& x) mutable {
+    cold().down_fun = [fn{move(fun)}](scheduled_actor*, down_msg& x) mutable {
       fn(x);
     };
   }
@@ -338,17 +415,17 @@ public:
   /// Sets a custom handler for node down messages.
   void set_node_down_handler(node_down_handler fun) {
     if (fun)
-      node_down_handler_ = std::move(fun);
+      cold().node_down_fun = std::move(fun);
     else
-      node_down_handler_ = default_node_down_handler;
+      cold().node_down_fun = default_node_down_handler;
   }
 
   /// Sets a custom handler for down messages.
   template <class F>
   std::enable_if_t<std::is_invocable_v<F, node_down_msg&>>
   set_node_down_handler(F fun) {
-    node_down_handler_ = [fn{std::move(fun)}](scheduled_actor*,
-                                              node_down_msg& x) mutable {
+    cold().node_down_fun = [fn{std::move(fun)}](scheduled_actor*,
+                                                node_down_msg& x) mutable {
       fn(x);
     };
   }
@@ -356,16 +433,16 @@ public:
   /// Sets a custom handler for error messages.
   void set_exit_handler(exit_handler fun) {
     if (fun)
-      exit_handler_ = std::move(fun);
+      cold().exit_fun = std::move(fun);
     else
-      exit_handler_ = default_exit_handler;
+      cold().exit_fun = default_exit_handler;
   }
 
   /// Sets a custom handler for exit messages.
   template <class F>
   std::enable_if_t<std::is_invocable_v<F, exit_msg&>> set_exit_handler(F fun) {
     using std::move;
-    exit_handler_ = [fn{move(fun)}](scheduled_actor*, exit_msg& x) mutable {
+    cold().exit_fun = [fn{move(fun)}](scheduled_actor*, exit_msg& x) mutable {
       fn(x);
     };
   }
@@ -375,9 +452,9 @@ public:
   /// defined, only the functor that was added *last* is being executed.
   void set_exception_handler(exception_handler fun) {
     if (fun)
-      exception_handler_ = std::move(fun);
+      cold().exception_fun = std::move(fun);
     else
-      exception_handler_ = default_exception_handler;
+      cold().exception_fun = default_exception_handler;
   }
 
   /// Sets a custom exception handler for this actor. If multiple handlers are
@@ -385,8 +462,8 @@ public:
   template <class F>
   std::enable_if_t<std::is_invocable_r_v<error, F, std::exception_ptr&>>
   set_exception_handler(F fun) {
-    exception_handler_ = [fn{std::move(fun)}](scheduled_actor*,
-                                              std::exception_ptr& x) mutable {
+    cold().exception_fun = [fn{std::move(fun)}](scheduled_actor*,
+                                                std::exception_ptr& x) mutable {
       return fn(x);
     };
   }
@@ -411,6 +488,17 @@ public:
   /// Requests a new timeout and returns its ID.
   uint64_t set_stream_timeout(actor_clock::time_point x);
 
+  /// Requests a new hibernation timeout and returns its ID.
+  uint64_t set_hibernation_timeout();
+
+  // -- hibernation ------------------------------------------------------------
+
+  /// Releases caches and the state of the actor if possible.
+  void hibernate();
+
+  /// Restores the state of a hibernating actor.
+  void wake_up();
+
   // -- message processing -----------------------------------------------------
 
   /// Adds a callback for an awaited response.
@@ -468,6 +556,17 @@ public:
   /// Pushes `ptr` to the cache of the default queue.
   void push_to_cache(mailbox_element_ptr ptr);
 
+  /// Checks whether `x` counts towards the capacity of a bounded mailbox.
+  bool is_bounded_message(const mailbox_element& x) const noexcept;
+
+  /// Discards `ptr` because the mailbox is full.
+  void drop_overflow(mailbox_element_ptr ptr, execution_unit* eu,
+                     bool notify_sender);
+
+  /// Discards the oldest messages in the normal queue until the mailbox no
+  /// longer exceeds its capacity.
+  void drop_oldest_messages();
+
   /// Returns the queue of the mailbox that stores high priority messages.
   urgent_queue& get_urgent_queue();
 
@@ -570,8 +669,18 @@ public:
       swap(g, f);
   }
 
+  /// Calls the handler at `member` in the cold state or `fallback` if the
+  /// actor never allocated its cold state.
+  template <class F, class Fallback, class... Ts>
+  auto call_cold_handler(F cold_state::*member, Fallback fallback,
+                         Ts&&... xs) {
+    if (cold_)
+      return call_handler(cold_.get()->*member, this, std::forward<Ts>(xs)...);
+    return fallback(this, std::forward<Ts>(xs)...);
+  }
+
   void call_error_handler(error& err) {
-    call_handler(error_handler_, this, err);
+    call_cold_handler(&cold_state::error_fun, default_error_handler, err);
   }
 
   // -- timeout management -----------------------------------------------------
@@ -626,6 +735,19 @@ public:
 
   // -- properties -------------------------------------------------------------
 
+  /// Returns the block with rarely used members and allocates it on first use.
+  cold_state& cold() {
+    if (!cold_)
+      cold_ = std::make_unique<cold_state>();
+    return *cold_;
+  }
+
+  /// Returns whether the actor has allocated its block with rarely used
+  /// members.
+  bool has_cold_state() const noexcept {
+    return cold_ != nullptr;
+  }
+
   /// Returns `true` if the actor has a behavior, awaits responses, or
   /// participates in streams.
   /// @private
@@ -661,22 +783,10 @@ protected:
   std::forward_list<pending_response> awaited_responses_;
 
   /// Stores callbacks for multiplexed responses.
-  detail::unordered_flat_map<message_id, behavior> multiplexed_responses_;
-
-  /// Customization point for setting a default `message` callback.
-  default_handler default_handler_;
-
-  /// Customization point for setting a default `error` callback.
-  error_handler error_handler_;
+  detail::response_handler_table multiplexed_responses_;
 
-  /// Customization point for setting a default `down_msg` callback.
-  down_handler down_handler_;
-
-  /// Customization point for setting a default `down_msg` callback.
-  node_down_handler node_down_handler_;
-
-  /// Customization point for setting a default `exit_msg` callback.
-  exit_handler exit_handler_;
+  /// Stores rarely used members or `nullptr`.
+  std::unique_ptr<cold_state> cold_;
 
   /// Stores stream managers for established streams.
   stream_manager_map stream_managers_;
@@ -689,22 +799,32 @@ protected:
   /// send a full stream batch.
   timespan max_batch_delay_;
 
-  /// Number of ticks per batch delay.
-  size_t max_batch_delay_ticks_;
-
   /// Pointer to a private thread object associated with a detached actor.
   detail::private_thread* private_thread_;
 
-  /// Caches metric objects for inbound stream traffic.
-  inbound_stream_metrics_map inbound_stream_metrics_;
+  /// Maximum number of bounded messages in the mailbox or 0 for unbounded.
+  size_t mailbox_capacity_;
 
-  /// Caches metric objects for outbound stream traffic.
-  outbound_stream_metrics_map outbound_stream_metrics_;
+  /// Configures how the actor handles messages that exceed the capacity.
+  mailbox_overflow_policy overflow_policy_;
 
-#ifdef CAF_ENABLE_EXCEPTIONS
-  /// Customization point for setting a default exception callback.
-  exception_handler exception_handler_;
-#endif // CAF_ENABLE_EXCEPTIONS
+  /// Counts bounded messages in the mailbox. Only used if
+  /// `mailbox_capacity_ > 0`.
+  std::atomic<size_t> mailbox_depth_;
+
+  /// Configures how long the actor may idle before hibernating.
+  timespan hibernation_timeout_;
+
+  /// Stores whether the actor processed a message since setting the last
+  /// hibernation timeout.
+  bool hibernation_activity_;
+
+  /// Stores whether the actor currently hibernates.
+  bool hibernating_;
+
+  /// Estimates how long the actor needs per message. Only used if the
+  /// scheduler assigns a time budget to each run of the actor.
+  timespan message_cost_;
 
 private:
   template <class F>
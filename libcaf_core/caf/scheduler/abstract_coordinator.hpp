@@ -16,6 +16,7 @@
 #include "caf/detail/core_export.hpp"
 #include "caf/fwd.hpp"
 #include "caf/message.hpp"
+#include "caf/timespan.hpp"
 
 namespace caf::scheduler {
 
@@ -52,10 +53,22 @@ public:
     return max_throughput_;
   }
 
+  /// Returns the time budget for each run of an actor or 0 if actors consume
+  /// up to `max_throughput()` messages regardless of their processing time.
+  timespan max_throughput_time() const noexcept {
+    return max_throughput_time_;
+  }
+
   size_t num_workers() const {
     return num_workers_;
   }
 
+  /// Returns the maximum number of consecutive runs from the LIFO slot of a
+  /// worker or 0 if workers have no LIFO slot.
+  size_t lifo_slot_limit() const {
+    return lifo_slot_limit_;
+  }
+
   /// Returns `true` if this scheduler detaches its utility actors.
   virtual bool detaches_utility_actors() const;
 
@@ -73,6 +86,13 @@ public:
 
   static size_t default_thread_count() noexcept;
 
+  /// Returns the worker running on the calling thread or `nullptr` if the
+  /// calling thread is not a worker of any scheduler.
+  static execution_unit* this_worker() noexcept;
+
+  /// Sets the worker running on the calling thread.
+  static void this_worker(execution_unit* ptr) noexcept;
+
 protected:
   void stop_actors();
 
@@ -82,9 +102,15 @@ protected:
   /// Number of messages each actor is allowed to consume per resume.
   size_t max_throughput_;
 
+  /// Time budget for each resume or 0 to disable the time budget.
+  timespan max_throughput_time_;
+
   /// Configured number of workers.
   size_t num_workers_;
 
+  /// Maximum number of consecutive runs from the LIFO slot of a worker.
+  size_t lifo_slot_limit_;
+
   /// Background workers, e.g., printer.
   std::array<actor, max_id> utility_actors_;
 
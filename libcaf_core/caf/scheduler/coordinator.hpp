@@ -11,6 +11,8 @@
 #include <memory>
 #include <thread>
 
+#include "caf/actor_system_config.hpp"
+#include "caf/defaults.hpp"
 #include "caf/detail/set_thread_name.hpp"
 #include "caf/detail/thread_safe_actor_clock.hpp"
 #include "caf/scheduler/abstract_coordinator.hpp"
@@ -40,11 +42,45 @@ public:
     return data_;
   }
 
+  /// Queries whether each worker owns a local timer shard.
+  bool worker_timers() const noexcept {
+    return worker_timers_;
+  }
+
+  /// Returns the resolution for timing wheels.
+  timespan clock_resolution() const noexcept {
+    return clock_resolution_;
+  }
+
+  /// Routes timeouts and delayed messages from the calling thread to `shard`
+  /// instead of the clock thread.
+  void bind_local_timers(detail::timing_wheel_actor_clock* shard) {
+    clock_.bind_local_shard(shard);
+  }
+
+  /// Applies cancellations that other threads sent to the local timer shard of
+  /// the calling thread.
+  size_t handle_remote_timer_cancellations() {
+    return clock_.handle_remote_cancellations();
+  }
+
   static actor_system::module* make(actor_system& sys, detail::type_list<>) {
     return new coordinator(sys);
   }
 
 protected:
+  void init(actor_system_config& cfg) override {
+    super::init(cfg);
+    namespace sr = defaults::scheduler;
+    clock_resolution_ = get_or(cfg, "caf.scheduler.clock-resolution",
+                               sr::clock_resolution);
+    if (get_or(cfg, "caf.scheduler.clock", sr::clock) == "timing-wheel")
+      clock_.use_timing_wheel(clock_resolution_);
+    if constexpr (Policy::supports_worker_timers)
+      worker_timers_ = get_or(cfg, "caf.scheduler.worker-timers",
+                              sr::worker_timers);
+  }
+
   void start() override {
     // Create initial state for all workers.
     typename worker_type::policy_data init{this};
@@ -127,6 +163,15 @@ protected:
   }
 
   void enqueue(resumable* ptr) override {
+    // with LIFO slots enabled, jobs scheduled from one of our own workers stay
+    // on that worker instead of going through the central dispatch
+    if (lifo_slot_limit_ > 0) {
+      auto eu = this_worker();
+      if (eu != nullptr && &eu->system() == &system()) {
+        eu->exec_later(ptr);
+        return;
+      }
+    }
     policy_.central_enqueue(this, ptr);
   }
 
@@ -149,6 +194,12 @@ private:
 
   /// Thread for managing timeouts and delayed messages.
   std::thread timer_;
+
+  /// Configures whether each worker owns a local timer shard.
+  bool worker_timers_ = false;
+
+  /// Resolution for timing wheels.
+  timespan clock_resolution_ = defaults::scheduler::clock_resolution;
 };
 
 } // namespace caf::scheduler
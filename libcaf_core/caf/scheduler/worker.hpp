@@ -4,13 +4,18 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <memory>
+#include <utility>
 
 #include "caf/detail/double_ended_queue.hpp"
 #include "caf/detail/set_thread_name.hpp"
+#include "caf/detail/timing_wheel_actor_clock.hpp"
 #include "caf/execution_unit.hpp"
 #include "caf/logger.hpp"
 #include "caf/resumable.hpp"
+#include "caf/scheduler/abstract_coordinator.hpp"
 
 namespace caf::scheduler {
 
@@ -29,10 +34,13 @@ public:
          const policy_data& init, size_t throughput)
     : execution_unit(&worker_parent->system()),
       max_throughput_(throughput),
+      lifo_slot_limit_(worker_parent->lifo_slot_limit()),
       id_(worker_id),
       parent_(worker_parent),
       data_(init) {
-    // nop
+    if (worker_parent->worker_timers())
+      timers_ = std::make_unique<detail::timing_wheel_actor_clock>(
+        worker_parent->clock_resolution());
   }
 
   void start() {
@@ -55,7 +63,16 @@ public:
   /// @warning Must not be called from other threads.
   void exec_later(job_ptr job) override {
     CAF_ASSERT(job != nullptr);
-    policy_.internal_enqueue(this, job);
+    // The policy may trigger our timers while waiting for a job, i.e., without
+    // checking the LIFO slot.
+    if (lifo_slot_limit_ == 0 || triggering_timers_) {
+      policy_.internal_enqueue(this, job);
+      return;
+    }
+    // The most recently scheduled job runs next, e.g., the receiver of a
+    // request. A previous occupant of the slot moves to the regular queue.
+    if (auto prev = std::exchange(lifo_slot_, job))
+      policy_.internal_enqueue(this, prev);
   }
 
   coordinator_ptr parent() {
@@ -84,12 +101,69 @@ public:
     return max_throughput_;
   }
 
+  /// Returns the local timer shard of this worker or `nullptr` if timeouts and
+  /// delayed messages go through the clock thread.
+  detail::timing_wheel_actor_clock* timers() noexcept {
+    return timers_.get();
+  }
+
+  /// Ships all expired timeouts and delayed messages of the local timer shard.
+  /// Receivers run on this worker afterwards.
+  /// @warning Must not be called from other threads.
+  size_t trigger_timers() {
+    if (!timers_)
+      return 0;
+    // Drop timeouts of actors that terminated on other workers first to make
+    // sure the shard releases their references in time.
+    parent_->handle_remote_timer_cancellations();
+    if (timers_->empty())
+      return 0;
+    triggering_timers_ = true;
+    auto result = timers_->trigger_expired_timeouts(this);
+    triggering_timers_ = false;
+    return result;
+  }
+
+  /// Returns how long this worker may wait for new jobs without missing a
+  /// timeout of its local timer shard, capped at `max_duration`.
+  timespan max_park_duration(timespan max_duration) const {
+    if (timers_)
+      if (auto t = timers_->next_timeout()) {
+        auto now = timers_->now();
+        if (*t <= now)
+          return timespan{0};
+        using std::chrono::duration_cast;
+        return std::min(max_duration, duration_cast<timespan>(*t - now));
+      }
+    return max_duration;
+  }
+
 private:
+  // Returns the job in the LIFO slot unless it exceeded the limit for
+  // consecutive runs, otherwise dequeues a job via the policy.
+  job_ptr next_job() {
+    if (auto job = std::exchange(lifo_slot_, nullptr)) {
+      if (lifo_slot_runs_ < lifo_slot_limit_) {
+        ++lifo_slot_runs_;
+        return job;
+      }
+      // Give all other jobs a chance to run first.
+      policy_.resume_job_later(this, job);
+    }
+    lifo_slot_runs_ = 0;
+    return policy_.dequeue(this);
+  }
+
   void run() {
     CAF_SET_LOGGER_SYS(&system());
+    abstract_coordinator::this_worker(this);
+    policy_.init_worker(this);
+    if (timers_)
+      parent_->bind_local_timers(timers_.get());
     // scheduling loop
     for (;;) {
-      auto job = policy_.dequeue(this);
+      trigger_timers();
+      auto job = next_job();
       CAF_ASSERT(job != nullptr);
       CAF_ASSERT(job->subtype() != resumable::io_actor);
       policy_.before_resume(this, job);
@@ -113,7 +187,15 @@ private:
         }
         case resumable::shutdown_execution_unit: {
           policy_.after_completion(this, job);
+          // Make sure the coordinator cleans up the job in our slot.
+          if (auto slot_job = std::exchange(lifo_slot_, nullptr))
+            policy_.internal_enqueue(this, slot_job);
           policy_.before_shutdown(this);
+          if (timers_) {
+            parent_->bind_local_timers(nullptr);
+            timers_->clear_schedule();
+          }
+          abstract_coordinator::this_worker(nullptr);
           return;
         }
       }
@@ -121,6 +203,16 @@ private:
   }
   // number of messages each actor is allowed to consume per resume
   size_t max_throughput_;
+  // maximum number of consecutive runs from the LIFO slot, 0 disables the slot
+  size_t lifo_slot_limit_;
+  // number of consecutive runs from the LIFO slot
+  size_t lifo_slot_runs_ = 0;
+  // holds the most recently scheduled job of this worker
+  job_ptr lifo_slot_ = nullptr;
+  // timeouts and delayed messages set by actors running on this worker
+  std::unique_ptr<detail::timing_wheel_actor_clock> timers_;
+  // bypasses the LIFO slot while shipping expired timeouts
+  bool triggering_timers_ = false;
   // the worker's thread
   std::thread this_thread_;
   // the worker's ID received from scheduler
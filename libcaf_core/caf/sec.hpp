@@ -163,6 +163,8 @@ enum class sec : uint8_t {
   broken_promise,
   /// Disconnected from a BASP node after reaching the connection timeout.
   connection_timeout,
+  /// An actor discarded a message because its bounded mailbox was full.
+  mailbox_full,
 };
 // --(rst-sec-end)--
 
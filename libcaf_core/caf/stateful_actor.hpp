@@ -7,6 +7,8 @@
 #include <new>
 #include <type_traits>
 
+#include "caf/binary_deserializer.hpp"
+#include "caf/binary_serializer.hpp"
 #include "caf/fwd.hpp"
 #include "caf/sec.hpp"
 #include "caf/unsafe_behavior_init.hpp"
@@ -32,6 +34,15 @@ using stateful_actor_base_t
   = std::conditional_t<has_make_behavior_member<State>::value,
                        stateful_actor_base<State, Base>, Base>;
 
+/// Checks whether `stateful_actor` can serialize, destroy and later restore a
+/// `State` while the actor hibernates.
+template <class State, class Self>
+constexpr bool can_hibernate_state
+  = has_inspect_overload<binary_serializer, State>::value
+    && has_inspect_overload<binary_deserializer, State>::value
+    && (std::is_default_constructible<State>::value
+        || std::is_constructible<State, Self*>::value);
+
 } // namespace caf::detail
 
 namespace caf {
@@ -64,6 +75,37 @@ public:
     state.~State();
   }
 
+  /// Serializes and destroys the state if it provides an `inspect` overload.
+  /// The actor restores the state in place, i.e., `&state` remains stable.
+  /// Hence, message handlers must access the state via `self->state` and must
+  /// not keep references to its members.
+  bool hibernate_state(byte_buffer& buf) override {
+    if constexpr (detail::can_hibernate_state<State, stateful_actor>) {
+      binary_serializer sink{this->system(), buf};
+      if (!sink.apply(state))
+        return false;
+      state.~State();
+      return true;
+    } else {
+      return Base::hibernate_state(buf);
+    }
+  }
+
+  error wake_up_state(const byte_buffer& buf) override {
+    if constexpr (detail::can_hibernate_state<State, stateful_actor>) {
+      if constexpr (std::is_default_constructible<State>::value)
+        new (&state) State();
+      else
+        new (&state) State(this);
+      binary_deserializer source{this->system(), buf};
+      if (!source.apply(state))
+        return source.get_error();
+      return none;
+    } else {
+      return Base::wake_up_state(buf);
+    }
+  }
+
   const char* name() const override {
     if constexpr (detail::has_name<State>::value) {
       if constexpr (!std::is_member_pointer<decltype(&State::name)>::value) {
@@ -0,0 +1,35 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/master/LICENSE.
+
+#pragma once
+
+#include <cstdint>
+
+#include "caf/detail/core_export.hpp"
+#include "caf/fwd.hpp"
+
+namespace caf::telemetry::importer {
+
+/// Imports the statistics of the process-wide @ref detail::memory_pool. This
+/// importer adds the metrics `caf.memory-pool.hits` (allocations served from
+/// a free list) and `caf.memory-pool.misses` (allocations that had to fall
+/// back to the system allocator while pooling was enabled).
+///
+/// @note CAF adds this importer automatically when configuring export to
+///       Prometheus via HTTP.
+class CAF_CORE_EXPORT memory_pool {
+public:
+  explicit memory_pool(metric_registry& reg);
+
+  /// Updates the memory pool metrics.
+  void update();
+
+private:
+  telemetry::int_counter* hits_ = nullptr;
+  telemetry::int_counter* misses_ = nullptr;
+  uint64_t last_hits_ = 0;
+  uint64_t last_misses_ = 0;
+};
+
+} // namespace caf::telemetry::importer
@@ -234,6 +234,10 @@ public:
     return self_->request_response_timeout(d, mid);
   }
 
+  void request_response_timeout(timespan d, std::vector<message_id> ids) {
+    return self_->request_response_timeout(d, std::move(ids));
+  }
+
   response_promise make_response_promise() {
     return self_->make_response_promise();
   }
@@ -46,6 +46,20 @@ void abstract_actor::enqueue(strong_actor_ptr sender, message_id mid,
   enqueue(make_mailbox_element(sender, mid, {}, std::move(msg)), host);
 }
 
+void abstract_actor::enqueue_batch(mailbox_element_ptr first,
+                                   execution_unit* host) {
+  while (first != nullptr) {
+    mailbox_element_ptr next{static_cast<mailbox_element*>(first->next)};
+    first->next = nullptr;
+    enqueue(std::move(first), host);
+    first = std::move(next);
+  }
+}
+
+bool abstract_actor::mailbox_congested() const noexcept {
+  return false;
+}
+
 abstract_actor::abstract_actor(actor_config& cfg)
     : abstract_channel(cfg.flags) {
   // nop
@@ -4,6 +4,8 @@
 
 #include "caf/actor_clock.hpp"
 
+#include "caf/message_id.hpp"
+
 namespace caf {
 
 // -- constructors, destructors, and assignment operators ----------------------
@@ -18,4 +20,12 @@ actor_clock::time_point actor_clock::now() const noexcept {
   return clock_type::now();
 }
 
+// -- scheduling ---------------------------------------------------------------
+
+void actor_clock::set_request_group_timeout(time_point t, abstract_actor* self,
+                                            std::vector<message_id> ids) {
+  for (auto id : ids)
+    set_request_timeout(t, self, id);
+}
+
 } // namespace caf
@@ -12,7 +12,9 @@ actor_config::actor_config(execution_unit* host, local_actor* parent)
   : host(host),
     parent(parent),
     flags(abstract_channel::is_abstract_actor_flag),
-    groups(nullptr) {
+    groups(nullptr),
+    mailbox_capacity(0),
+    overflow_policy(mailbox_overflow_policy::drop_newest) {
   // nop
 }
 
@@ -32,6 +34,14 @@ std::string to_string(const actor_config& x) {
   add(abstract_actor::is_detached_flag, "detached_flag");
   add(abstract_actor::is_blocking_flag, "blocking_flag");
   add(abstract_actor::is_hidden_flag, "hidden_flag");
+  if (x.mailbox_capacity > 0) {
+    if (result.back() != '(')
+      result += ", ";
+    result += "mailbox_capacity = ";
+    result += std::to_string(x.mailbox_capacity);
+    result += ", overflow_policy = ";
+    result += to_string(x.overflow_policy);
+  }
   result += ')';
   return result;
 }
@@ -27,6 +27,11 @@ void actor_control_block::enqueue(mailbox_element_ptr what,
   get()->enqueue(std::move(what), host);
 }
 
+void actor_control_block::enqueue_batch(mailbox_element_ptr first,
+                                        execution_unit* host) {
+  get()->enqueue_batch(std::move(first), host);
+}
+
 bool intrusive_ptr_upgrade_weak(actor_control_block* x) {
   auto count = x->strong_refs.load();
   while (count != 0)
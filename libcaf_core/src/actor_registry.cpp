@@ -39,9 +39,10 @@ actor_registry::actor_registry(actor_system& sys) : system_(sys) {
 }
 
 strong_actor_ptr actor_registry::get_impl(actor_id key) const {
-  shared_guard guard(instances_mtx_);
-  auto i = entries_.find(key);
-  if (i != entries_.end())
+  auto& dst = shard_of(key);
+  shared_guard guard(dst.mtx);
+  auto i = dst.map.find(key);
+  if (i != dst.map.end())
     return i->second;
   CAF_LOG_DEBUG("key invalid, assume actor no longer exists:" << CAF_ARG(key));
   return nullptr;
@@ -52,8 +53,9 @@ void actor_registry::put_impl(actor_id key, strong_actor_ptr val) {
   if (!val)
     return;
   { // lifetime scope of guard
-    exclusive_guard guard(instances_mtx_);
-    if (!entries_.emplace(key, val).second)
+    auto& dst = shard_of(key);
+    exclusive_guard guard(dst.mtx);
+    if (!dst.map.emplace(key, val).second)
       return;
   }
   // attach functor without lock
@@ -71,11 +73,12 @@ void actor_registry::erase(actor_id key) {
   // that in turn calls this function and we can end up in a deadlock.
   strong_actor_ptr ref;
   { // Lifetime scope of guard.
-    exclusive_guard guard{instances_mtx_};
-    auto i = entries_.find(key);
-    if (i != entries_.end()) {
+    auto& dst = shard_of(key);
+    exclusive_guard guard{dst.mtx};
+    auto i = dst.map.find(key);
+    if (i != dst.map.end()) {
       ref.swap(i->second);
-      entries_.erase(i);
+      dst.map.erase(i);
     }
   }
 }
@@ -148,9 +151,9 @@ void actor_registry::start() {
 }
 
 void actor_registry::stop() {
-  {
-    exclusive_guard guard{instances_mtx_};
-    entries_.clear();
+  for (auto& dst : shards_) {
+    exclusive_guard guard{dst.mtx};
+    dst.map.clear();
   }
   {
     exclusive_guard guard{named_entries_mtx_};
@@ -9,8 +9,10 @@
 #include "caf/actor.hpp"
 #include "caf/actor_system_config.hpp"
 #include "caf/defaults.hpp"
+#include "caf/detail/memory_pool.hpp"
 #include "caf/detail/meta_object.hpp"
 #include "caf/event_based_actor.hpp"
+#include "caf/policy/lock_free_work_stealing.hpp"
 #include "caf/policy/work_sharing.hpp"
 #include "caf/policy/work_stealing.hpp"
 #include "caf/raise_error.hpp"
@@ -243,6 +245,18 @@ auto make_actor_metric_families(telemetry::metric_registry& reg) {
       "Time a message waits in the mailbox before processing.", "seconds"),
     reg.gauge_family("caf.actor", "mailbox-size", {"name"},
                      "Number of messages in the mailbox."),
+    reg.counter_family("caf.actor", "mailbox-drops", {"name"},
+                       "Number of messages dropped due to a full mailbox."),
+    reg.counter_family("caf.actor", "time-slice-overruns", {"name"},
+                       "Number of runs that exceeded the time budget."),
+    reg.gauge_family("caf.actor", "hibernating-actors", {"name"},
+                     "Number of hibernating actors."),
+    reg.gauge_family("caf.actor", "hibernated-bytes", {"name"},
+                     "Size of the serialized state of hibernating actors.",
+                     "bytes"),
+    reg.histogram_family<double>(
+      "caf.actor", "wakeup-time", {"name"}, default_buckets,
+      "Time an actor needs to restore its state after hibernating.", "seconds"),
     {
       reg.counter_family("caf.actor.stream", "processed-elements",
                          {"name", "type"},
@@ -292,6 +306,12 @@ actor_system::actor_system(actor_system_config& cfg)
     metrics_actors_excludes_ = std::move(*lst);
   if (!metrics_actors_includes_.empty())
     actor_metric_families_ = make_actor_metric_families(metrics_);
+  // The memory pool is process-wide, so we only touch it when the user
+  // explicitly configured it.
+  if (auto enable = get_as<bool>(cfg, "caf.memory-pool.enable"))
+    detail::memory_pool::enable(*enable);
+  if (auto limit = get_as<size_t>(cfg, "caf.memory-pool.max-cached-blocks"))
+    detail::memory_pool::max_cached_blocks(*limit);
   // Spin up modules.
   for (auto& f : cfg.module_factories) {
     auto mod_ptr = f(*this);
@@ -314,15 +334,18 @@ actor_system::actor_system(actor_system_config& cfg)
   // Make sure we have a scheduler up and running.
   auto& sched = modules_[module::scheduler];
   using namespace scheduler;
+  using policy::lock_free_work_stealing;
   using policy::work_sharing;
   using policy::work_stealing;
   using share = coordinator<work_sharing>;
   using steal = coordinator<work_stealing>;
+  using lf_steal = coordinator<lock_free_work_stealing>;
   if (!sched) {
     enum sched_conf {
       stealing = 0x0001,
       sharing = 0x0002,
       testing = 0x0003,
+      lock_free_stealing = 0x0004,
     };
     sched_conf sc = stealing;
     namespace sr = defaults::scheduler;
@@ -331,6 +354,8 @@ actor_system::actor_system(actor_system_config& cfg)
       sc = sharing;
     else if (sr_policy == "testing")
       sc = testing;
+    else if (sr_policy == "lock-free-stealing")
+      sc = lock_free_stealing;
     else if (sr_policy != "stealing")
       std::cerr << "[WARNING] " << deep_to_string(sr_policy)
                 << " is an unrecognized scheduler pollicy, "
@@ -345,6 +370,9 @@ actor_system::actor_system(actor_system_config& cfg)
         break;
       case testing:
         sched.reset(new test_coordinator(*this));
+        break;
+      case lock_free_stealing:
+        sched.reset(new lf_steal(*this));
     }
   }
   // Initialize state for each module and give each module the opportunity to
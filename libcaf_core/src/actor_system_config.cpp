@@ -69,9 +69,23 @@ actor_system_config::actor_system_config()
     .add<int32_t>("batch-size", "number of elements per batch")
     .add<int32_t>("buffer-size", "max. number of elements in the input buffer");
   opt_group{custom_options_, "caf.scheduler"}
-    .add<string>("policy", "'stealing' (default) or 'sharing'")
+    .add<string>("policy", "'stealing' (default), 'lock-free-stealing' or "
+                         "'sharing'")
     .add<size_t>("max-threads", "maximum number of worker threads")
     .add<size_t>("max-throughput", "nr. of messages actors can consume per run")
+    .add<timespan>("max-throughput-time",
+                   "time budget for each run of an actor (0 = disabled)")
+    .add<size_t>("lifo-slot-limit",
+                 "max. consecutive runs from the LIFO slot (0 = disabled)")
+    .add<bool>("pin-workers", "pins each worker thread to a single CPU")
+    .add<bool>("topology-aware-stealing",
+               "prefers victims sharing a cache or NUMA node (implies "
+               "pin-workers)")
+    .add<string>("clock", "'simple' (default) or 'timing-wheel'")
+    .add<timespan>("clock-resolution",
+                   "granularity of the timing wheel clock")
+    .add<bool>("worker-timers",
+               "keeps timeouts of actors in local timers of each worker")
     .add<bool>("enable-profiling", "enables profiler output")
     .add<timespan>("profiling-resolution", "data collection rate")
     .add<string>("profiling-output-file", "output file for the profiler");
@@ -87,7 +101,13 @@ actor_system_config::actor_system_config()
     .add<size_t>("relaxed-steal-interval",
                  "frequency of relaxed steal attempts")
     .add<timespan>("relaxed-sleep-duration",
-                   "sleep duration between relaxed steal attempts");
+                   "sleep duration between relaxed steal attempts")
+    .add<bool>("batch-steal",
+               "steals up to half of the victim's jobs at once");
+  opt_group{custom_options_, "caf.memory-pool"}
+    .add<bool>("enable", "recycles memory of messages and mailbox elements")
+    .add<size_t>("max-cached-blocks",
+                 "max. number of free blocks per size class and thread");
   opt_group{custom_options_, "caf.logger"} //
     .add<bool>("inline-output", "disable logger thread (for testing only!)");
   opt_group{custom_options_, "caf.logger.file"}
@@ -122,6 +142,18 @@ settings actor_system_config::dump_content() const {
   put_missing(scheduler_group, "policy", defaults::scheduler::policy);
   put_missing(scheduler_group, "max-throughput",
               defaults::scheduler::max_throughput);
+  put_missing(scheduler_group, "max-throughput-time",
+              defaults::scheduler::max_throughput_time);
+  put_missing(scheduler_group, "lifo-slot-limit",
+              defaults::scheduler::lifo_slot_limit);
+  put_missing(scheduler_group, "pin-workers", defaults::scheduler::pin_workers);
+  put_missing(scheduler_group, "topology-aware-stealing",
+              defaults::scheduler::topology_aware_stealing);
+  put_missing(scheduler_group, "clock", defaults::scheduler::clock);
+  put_missing(scheduler_group, "clock-resolution",
+              defaults::scheduler::clock_resolution);
+  put_missing(scheduler_group, "worker-timers",
+              defaults::scheduler::worker_timers);
   put_missing(scheduler_group, "enable-profiling", false);
   put_missing(scheduler_group, "profiling-resolution",
               defaults::scheduler::profiling_resolution);
@@ -142,6 +174,13 @@ settings actor_system_config::dump_content() const {
               defaults::work_stealing::relaxed_steal_interval);
   put_missing(work_stealing_group, "relaxed-sleep-duration",
               defaults::work_stealing::relaxed_sleep_duration);
+  put_missing(work_stealing_group, "batch-steal",
+              defaults::work_stealing::batch_steal);
+  // -- memory pool parameters
+  auto& memory_pool_group = caf_group["memory-pool"].as_dictionary();
+  put_missing(memory_pool_group, "enable", defaults::memory_pool::enable);
+  put_missing(memory_pool_group, "max-cached-blocks",
+              defaults::memory_pool::max_cached_blocks);
   // -- logger parameters
   auto& logger_group = caf_group["logger"].as_dictionary();
   put_missing(logger_group, "inline-output", false);
@@ -4,7 +4,9 @@
 
 #include "caf/binary_deserializer.hpp"
 
+#include <cstring>
 #include <iomanip>
+#include <limits>
 #include <sstream>
 #include <type_traits>
 
@@ -49,6 +51,61 @@ void unsafe_int_value(binary_deserializer& source, T& x) {
   x = static_cast<T>(detail::from_network_order(tmp));
 }
 
+// Selects the unsigned integer representation that `value` reads for `T`.
+template <class T, bool IsFloat = std::is_floating_point<T>::value>
+struct packed {
+  using type = std::make_unsigned_t<T>;
+};
+
+template <class T>
+struct packed<T, true> {
+  using type = typename detail::ieee_754_trait<T>::packed_type;
+};
+
+// Converts the unsigned integer representation `bits` back to a `T`.
+template <class T, class Packed>
+T unpacked_value(Packed bits) {
+  if constexpr (std::is_floating_point<T>::value) {
+    using trait = detail::ieee_754_trait<T>;
+    if constexpr (std::numeric_limits<T>::is_iec559) {
+      // For normalized numbers, unpack754 restores the native representation.
+      constexpr auto exp_mask = ((Packed{1} << trait::expbits) - 1)
+                                << (trait::bits - trait::expbits - 1);
+      if (auto exp = bits & exp_mask; exp != 0 && exp != exp_mask) {
+        T result;
+        memcpy(&result, &bits, sizeof(T));
+        return result;
+      }
+    }
+    return detail::unpack754(bits);
+  } else {
+    return static_cast<T>(bits);
+  }
+}
+
+template <class T>
+bool bulk_value(binary_deserializer& source, span<T> xs) {
+  if (xs.size() > source.remaining() / sizeof(T)) {
+    source.emplace_error(sec::end_of_stream);
+    return false;
+  }
+  if (xs.empty())
+    return true;
+  auto in = source.current();
+  if constexpr (sizeof(T) == 1) {
+    memcpy(xs.data(), in, xs.size());
+  } else {
+    for (auto& x : xs) {
+      typename packed<T>::type tmp;
+      memcpy(&tmp, in, sizeof(tmp));
+      x = unpacked_value<T>(detail::from_network_order(tmp));
+      in += sizeof(tmp);
+    }
+  }
+  source.skip(xs.size() * sizeof(T));
+  return true;
+}
+
 } // namespace
 
 binary_deserializer::binary_deserializer(actor_system& sys) noexcept
@@ -355,4 +412,65 @@ bool binary_deserializer::value(std::vector<bool>& x) {
   return end_sequence();
 }
 
+bool binary_deserializer::value(span<int8_t> xs) noexcept {
+  return bulk_value(*this, xs);
+}
+
+bool binary_deserializer::value(span<uint8_t> xs) noexcept {
+  return bulk_value(*this, xs);
+}
+
+bool binary_deserializer::value(span<int16_t> xs) noexcept {
+  return bulk_value(*this, xs);
+}
+
+bool binary_deserializer::value(span<uint16_t> xs) noexcept {
+  return bulk_value(*this, xs);
+}
+
+bool binary_deserializer::value(span<int32_t> xs) noexcept {
+  return bulk_value(*this, xs);
+}
+
+bool binary_deserializer::value(span<uint32_t> xs) noexcept {
+  return bulk_value(*this, xs);
+}
+
+bool binary_deserializer::value(span<int64_t> xs) noexcept {
+  return bulk_value(*this, xs);
+}
+
+bool binary_deserializer::value(span<uint64_t> xs) noexcept {
+  return bulk_value(*this, xs);
+}
+
+bool binary_deserializer::value(span<float> xs) noexcept {
+  return bulk_value(*this, xs);
+}
+
+bool binary_deserializer::value(span<double> xs) noexcept {
+  return bulk_value(*this, xs);
+}
+
+bool binary_deserializer::read_view(string_view& x) noexcept {
+  span<const byte> bytes;
+  if (!read_view(bytes))
+    return false;
+  x = string_view{reinterpret_cast<const char*>(bytes.data()), bytes.size()};
+  return true;
+}
+
+bool binary_deserializer::read_view(span<const byte>& x) noexcept {
+  size_t size = 0;
+  if (!begin_sequence(size))
+    return false;
+  if (!range_check(size)) {
+    emplace_error(sec::end_of_stream);
+    return false;
+  }
+  x = make_span(current_, size);
+  current_ += size;
+  return end_sequence();
+}
+
 } // namespace caf
@@ -4,7 +4,9 @@
 
 #include "caf/binary_serializer.hpp"
 
+#include <cstring>
 #include <iomanip>
+#include <limits>
 
 #include "caf/actor_system.hpp"
 #include "caf/detail/ieee_754.hpp"
@@ -22,6 +24,46 @@ auto int_value(binary_serializer& sink, T x) {
   return sink.value(as_bytes(make_span(&y, 1)));
 }
 
+// Converts `x` to the unsigned integer representation that `value` writes.
+template <class T>
+auto packed_value(T x) {
+  if constexpr (std::is_floating_point<T>::value) {
+    using trait = detail::ieee_754_trait<T>;
+    using packed_type = typename trait::packed_type;
+    if constexpr (std::numeric_limits<T>::is_iec559) {
+      // For normalized numbers, pack754 produces the native representation.
+      constexpr auto exp_mask = ((packed_type{1} << trait::expbits) - 1)
+                                << (trait::bits - trait::expbits - 1);
+      packed_type bits;
+      memcpy(&bits, &x, sizeof(T));
+      if (auto exp = bits & exp_mask; exp != 0 && exp != exp_mask)
+        return bits;
+    }
+    return detail::pack754(x);
+  } else {
+    return static_cast<std::make_unsigned_t<T>>(x);
+  }
+}
+
+template <class T>
+bool bulk_value(binary_serializer& sink, span<const T> xs) {
+  if (xs.empty())
+    return true;
+  auto offset = sink.write_pos();
+  sink.skip(xs.size() * sizeof(T));
+  auto out = sink.buf().data() + offset;
+  if constexpr (sizeof(T) == 1) {
+    memcpy(out, xs.data(), xs.size());
+  } else {
+    for (auto x : xs) {
+      auto y = detail::to_network_order(packed_value(x));
+      memcpy(out, &y, sizeof(y));
+      out += sizeof(y);
+    }
+  }
+  return true;
+}
+
 } // namespace
 
 binary_serializer::binary_serializer(actor_system& sys,
@@ -283,4 +325,44 @@ bool binary_serializer::value(const std::vector<bool>& x) {
   return end_sequence();
 }
 
+bool binary_serializer::value(span<const int8_t> xs) {
+  return bulk_value(*this, xs);
+}
+
+bool binary_serializer::value(span<const uint8_t> xs) {
+  return bulk_value(*this, xs);
+}
+
+bool binary_serializer::value(span<const int16_t> xs) {
+  return bulk_value(*this, xs);
+}
+
+bool binary_serializer::value(span<const uint16_t> xs) {
+  return bulk_value(*this, xs);
+}
+
+bool binary_serializer::value(span<const int32_t> xs) {
+  return bulk_value(*this, xs);
+}
+
+bool binary_serializer::value(span<const uint32_t> xs) {
+  return bulk_value(*this, xs);
+}
+
+bool binary_serializer::value(span<const int64_t> xs) {
+  return bulk_value(*this, xs);
+}
+
+bool binary_serializer::value(span<const uint64_t> xs) {
+  return bulk_value(*this, xs);
+}
+
+bool binary_serializer::value(span<const float> xs) {
+  return bulk_value(*this, xs);
+}
+
+bool binary_serializer::value(span<const double> xs) {
+  return bulk_value(*this, xs);
+}
+
 } // namespace caf
@@ -513,7 +513,8 @@ config_value::parse_msg_impl(string_view str,
       reader.begin_sequence(unused);
       CAF_ASSERT(unused == ls_size);
       intrusive_ptr<detail::message_data> ptr;
-      if (auto vptr = malloc(sizeof(detail::message_data) + ls.data_size()))
+      if (auto vptr = detail::memory_pool::allocate(sizeof(detail::message_data)
+                                                    + ls.data_size()))
         ptr.reset(new (vptr) detail::message_data(ls), false);
       else
         return false;
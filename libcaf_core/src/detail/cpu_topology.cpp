@@ -0,0 +1,161 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/master/LICENSE.
+
+#include "caf/detail/cpu_topology.hpp"
+
+#include "caf/config.hpp"
+#include "caf/string_algorithms.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <string>
+#include <tuple>
+
+#ifdef CAF_LINUX
+#  include <dirent.h>
+#  include <pthread.h>
+#  include <sched.h>
+
+#  include <fstream>
+#endif // CAF_LINUX
+
+namespace caf::detail {
+
+namespace {
+
+// Parses a non-negative decimal number, returning -1 on error.
+int parse_id(string_view str) {
+  if (str.empty() || str.size() > 9)
+    return -1;
+  int result = 0;
+  for (auto c : str) {
+    if (!isdigit(static_cast<unsigned char>(c)))
+      return -1;
+    result = result * 10 + (c - '0');
+  }
+  return result;
+}
+
+} // namespace
+
+std::vector<int> parse_cpu_list(string_view str) {
+  std::vector<int> result;
+  while (!str.empty() && isspace(static_cast<unsigned char>(str.back())))
+    str.remove_suffix(1);
+  if (str.empty())
+    return result;
+  std::vector<string_view> ranges;
+  split(ranges, str, ",");
+  for (auto range : ranges) {
+    auto sep = range.find('-');
+    if (sep == string_view::npos) {
+      auto id = parse_id(range);
+      if (id < 0)
+        return {};
+      result.emplace_back(id);
+    } else {
+      auto first = parse_id(range.substr(0, sep));
+      auto last = parse_id(range.substr(sep + 1));
+      if (first < 0 || last < first)
+        return {};
+      for (auto id = first; id <= last; ++id)
+        result.emplace_back(id);
+    }
+  }
+  std::sort(result.begin(), result.end());
+  result.erase(std::unique(result.begin(), result.end()), result.end());
+  return result;
+}
+
+#ifdef CAF_LINUX
+
+namespace {
+
+constexpr const char* cpu_dir = "/sys/devices/system/cpu/";
+
+std::string read_line(const std::string& path) {
+  std::string result;
+  std::ifstream in{path};
+  if (in)
+    std::getline(in, result);
+  return result;
+}
+
+// Returns the lowest CPU ID sharing the last-level cache with `id`.
+int read_cache_group(int id) {
+  auto dir = cpu_dir + ("cpu" + std::to_string(id)) + "/cache/";
+  auto max_level = 0;
+  auto result = id;
+  for (int index = 0;; ++index) {
+    auto prefix = dir + "index" + std::to_string(index) + '/';
+    auto level = parse_id(read_line(prefix + "level"));
+    if (level < 0)
+      break;
+    if (level > max_level) {
+      auto cpus = parse_cpu_list(read_line(prefix + "shared_cpu_list"));
+      if (!cpus.empty()) {
+        max_level = level;
+        result = cpus.front();
+      }
+    }
+  }
+  return result;
+}
+
+// Returns the NUMA node of `id` by looking for a `node<N>` link.
+int read_node(int id) {
+  auto dir = cpu_dir + ("cpu" + std::to_string(id));
+  auto result = 0;
+  if (auto dptr = opendir(dir.c_str())) {
+    while (auto entry = readdir(dptr)) {
+      string_view name{entry->d_name};
+      if (starts_with(name, "node")) {
+        auto node = parse_id(name.substr(4));
+        if (node >= 0) {
+          result = node;
+          break;
+        }
+      }
+    }
+    closedir(dptr);
+  }
+  return result;
+}
+
+} // namespace
+
+std::vector<cpu_info> cpu_topology() {
+  std::vector<cpu_info> result;
+  for (auto id : parse_cpu_list(read_line(std::string{cpu_dir} + "online")))
+    result.emplace_back(cpu_info{id, read_cache_group(id), read_node(id)});
+  auto key = [](const cpu_info& x) {
+    return std::make_tuple(x.node, x.cache_group, x.id);
+  };
+  std::sort(result.begin(), result.end(),
+            [&](const cpu_info& x, const cpu_info& y) {
+              return key(x) < key(y);
+            });
+  return result;
+}
+
+bool pin_this_thread(int id) {
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(id, &set);
+  return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &set) == 0;
+}
+
+#else // CAF_LINUX
+
+std::vector<cpu_info> cpu_topology() {
+  return {};
+}
+
+bool pin_this_thread(int) {
+  return false;
+}
+
+#endif // CAF_LINUX
+
+} // namespace caf::detail
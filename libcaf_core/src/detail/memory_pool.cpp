@@ -0,0 +1,239 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/master/LICENSE.
+
+#include "caf/detail/memory_pool.hpp"
+
+#include "caf/defaults.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace caf::detail {
+
+namespace {
+
+// Marks blocks that are too large for any size class.
+constexpr size_t unpooled = memory_pool::num_size_classes;
+
+// Marks the second object in a block from `allocate_pair`.
+constexpr size_t interior = memory_pool::num_size_classes + 1;
+
+// Flags the first object in a block from `allocate_pair`. Only these blocks
+// use the reference count in their header.
+constexpr size_t pair_flag = size_t{1} << (sizeof(size_t) * 8 - 1);
+
+// Prefixes each block as well as the second object of a pair.
+struct block_header {
+  block_header(size_t tag, size_t value) noexcept : tag(tag), value(value) {
+    // nop
+  }
+
+  // Stores the size class, `unpooled` or `interior`. The first object of a
+  // pair additionally sets `pair_flag`.
+  size_t tag;
+
+  // Stores the number of remaining owners of a pair (unused for regular
+  // blocks) or the offset to the first object if `tag == interior`.
+  std::atomic<size_t> value;
+};
+
+static_assert(sizeof(block_header) == memory_pool::header_size);
+
+// Threads publish their hit and miss counts after this many pool operations.
+constexpr uint64_t publish_interval = 256;
+
+std::atomic<bool> global_enabled{defaults::memory_pool::enable};
+
+std::atomic<size_t> global_max_cached_blocks{
+  defaults::memory_pool::max_cached_blocks};
+
+std::atomic<uint64_t> global_hits;
+
+std::atomic<uint64_t> global_misses;
+
+// Overlays the first bytes of a free block to form a singly linked list.
+struct free_block {
+  free_block* next;
+};
+
+struct thread_cache {
+  free_block* heads[memory_pool::num_size_classes] = {};
+
+  size_t sizes[memory_pool::num_size_classes] = {};
+
+  uint64_t hits = 0;
+
+  uint64_t misses = 0;
+
+  uint64_t ops = 0;
+
+  void publish() noexcept {
+    if (hits > 0) {
+      global_hits.fetch_add(hits, std::memory_order_relaxed);
+      hits = 0;
+    }
+    if (misses > 0) {
+      global_misses.fetch_add(misses, std::memory_order_relaxed);
+      misses = 0;
+    }
+    ops = 0;
+  }
+
+  void count(bool hit) noexcept {
+    ++(hit ? hits : misses);
+    if (++ops == publish_interval)
+      publish();
+  }
+
+  ~thread_cache();
+};
+
+enum class cache_state : uint8_t { uninitialized, alive, destroyed };
+
+// Trivially destructible, i.e., remains accessible after `local_cache` died.
+// This allows static objects to release blocks during thread or process
+// shutdown.
+thread_local cache_state local_cache_state;
+
+thread_local thread_cache local_cache;
+
+thread_cache::~thread_cache() {
+  local_cache_state = cache_state::destroyed;
+  publish();
+  for (auto head : heads) {
+    while (head != nullptr) {
+      auto next = head->next;
+      free(head);
+      head = next;
+    }
+  }
+}
+
+thread_cache* get_local_cache() noexcept {
+  switch (local_cache_state) {
+    case cache_state::alive:
+      return &local_cache;
+    case cache_state::uninitialized:
+      local_cache_state = cache_state::alive;
+      return &local_cache;
+    default:
+      return nullptr;
+  }
+}
+
+size_t size_class_of(size_t size) noexcept {
+  if (size > memory_pool::max_pooled_size)
+    return unpooled;
+  return (size + memory_pool::header_size - 1) / memory_pool::size_class_step;
+}
+
+void* to_user_ptr(void* block, size_t size_class) noexcept {
+  new (block) block_header(size_class, 0);
+  return static_cast<char*>(block) + memory_pool::header_size;
+}
+
+block_header* header_of(void* ptr) noexcept {
+  return reinterpret_cast<block_header*>(static_cast<char*>(ptr)
+                                         - memory_pool::header_size);
+}
+
+} // namespace
+
+void* memory_pool::allocate(size_t size) noexcept {
+  auto size_class = size_class_of(size);
+  // Without pooling, blocks only pay for the header.
+  if (size_class == unpooled || !enabled()) {
+    if (auto block = malloc(size + header_size))
+      return to_user_ptr(block, unpooled);
+    return nullptr;
+  }
+  if (auto cache = get_local_cache()) {
+    auto& head = cache->heads[size_class];
+    if (head != nullptr) {
+      auto block = head;
+      head = block->next;
+      --cache->sizes[size_class];
+      cache->count(true);
+      return to_user_ptr(block, size_class);
+    }
+    cache->count(false);
+  }
+  // Always allocate the full size class to allow recycling the block later.
+  if (auto block = malloc((size_class + 1) * size_class_step))
+    return to_user_ptr(block, size_class);
+  return nullptr;
+}
+
+void* memory_pool::allocate_pair(size_t first_size, size_t second_size,
+                                 void*& second) noexcept {
+  auto offset = pair_offset(first_size);
+  auto ptr = allocate(offset + second_size);
+  if (ptr == nullptr)
+    return nullptr;
+  auto hdr = header_of(ptr);
+  hdr->tag |= pair_flag;
+  hdr->value.store(2, std::memory_order_relaxed);
+  second = static_cast<char*>(ptr) + offset;
+  new (header_of(second)) block_header(interior, offset);
+  return ptr;
+}
+
+void memory_pool::deallocate(void* ptr) noexcept {
+  if (ptr == nullptr)
+    return;
+  auto hdr = header_of(ptr);
+  auto size_class = hdr->tag;
+  if (size_class == unpooled) {
+    free(hdr);
+    return;
+  }
+  if (size_class == interior) {
+    ptr = static_cast<char*>(ptr) - hdr->value.load(std::memory_order_relaxed);
+    hdr = header_of(ptr);
+    size_class = hdr->tag;
+  }
+  // Only the last owner of a pair may release the block.
+  if ((size_class & pair_flag) != 0) {
+    if (hdr->value.fetch_sub(1, std::memory_order_acq_rel) != 1)
+      return;
+    size_class &= ~pair_flag;
+  }
+  auto block = reinterpret_cast<char*>(hdr);
+  if (size_class != unpooled && enabled()) {
+    if (auto cache = get_local_cache();
+        cache != nullptr && cache->sizes[size_class] < max_cached_blocks()) {
+      auto node = reinterpret_cast<free_block*>(block);
+      node->next = cache->heads[size_class];
+      cache->heads[size_class] = node;
+      ++cache->sizes[size_class];
+      return;
+    }
+  }
+  free(block);
+}
+
+void memory_pool::enable(bool value) noexcept {
+  global_enabled.store(value, std::memory_order_relaxed);
+}
+
+bool memory_pool::enabled() noexcept {
+  return global_enabled.load(std::memory_order_relaxed);
+}
+
+void memory_pool::max_cached_blocks(size_t value) noexcept {
+  global_max_cached_blocks.store(value, std::memory_order_relaxed);
+}
+
+size_t memory_pool::max_cached_blocks() noexcept {
+  return global_max_cached_blocks.load(std::memory_order_relaxed);
+}
+
+memory_pool::statistics memory_pool::stats() noexcept {
+  if (auto cache = get_local_cache())
+    cache->publish();
+  return {global_hits.load(), global_misses.load()};
+}
+
+} // namespace caf::detail
@@ -46,7 +46,7 @@ message_data* message_data::copy() const {
   for (auto id : types_)
     storage_size += gmos[id].padded_size;
   auto total_size = sizeof(message_data) + storage_size;
-  auto vptr = malloc(total_size);
+  auto vptr = memory_pool::allocate(total_size);
   if (vptr == nullptr)
     CAF_RAISE_ERROR(std::bad_alloc, "bad_alloc");
   intrusive_ptr<message_data> ptr{new (vptr) message_data(types_), false};
@@ -69,7 +69,7 @@ message_data::make_uninitialized(type_id_list types) {
   for (auto id : types)
     storage_size += gmos[id].padded_size;
   auto total_size = sizeof(message_data) + storage_size;
-  auto vptr = malloc(total_size);
+  auto vptr = memory_pool::allocate(total_size);
   if (vptr == nullptr)
     CAF_RAISE_ERROR(std::bad_alloc, "bad_alloc");
   return {new (vptr) message_data(types), false};
@@ -0,0 +1,108 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/master/LICENSE.
+
+#include "caf/detail/response_handler_table.hpp"
+
+#include <utility>
+
+#include "caf/config.hpp"
+
+namespace caf::detail {
+
+// -- modifiers ----------------------------------------------------------------
+
+bool response_handler_table::emplace(message_id id, behavior bhvr) {
+  CAF_ASSERT(id.integer_value() != 0);
+  auto key = id.integer_value();
+  if (find(id) != nullptr)
+    return false;
+  if (slots_.empty())
+    grow();
+  while (slot_of(key).key != 0
+         && slots_.size() < max_sparseness * (size_ + 1))
+    grow();
+  auto& x = slot_of(key);
+  if (x.key == 0) {
+    x.key = key;
+    x.value = std::move(bhvr);
+  } else {
+    overflow_.emplace(key, std::move(bhvr));
+  }
+  ++size_;
+  return true;
+}
+
+behavior* response_handler_table::find(message_id id) noexcept {
+  auto key = id.integer_value();
+  if (size_ == 0 || key == 0)
+    return nullptr;
+  if (auto& x = slot_of(key); x.key == key)
+    return &x.value;
+  if (overflow_.empty())
+    return nullptr;
+  auto i = overflow_.find(key);
+  return i != overflow_.end() ? &i->second : nullptr;
+}
+
+bool response_handler_table::take(message_id id, behavior& result) {
+  auto key = id.integer_value();
+  if (size_ == 0 || key == 0)
+    return false;
+  if (auto& x = slot_of(key); x.key == key) {
+    result = std::move(x.value);
+    x.key = 0;
+    x.value = behavior{};
+    --size_;
+    return true;
+  }
+  if (overflow_.empty())
+    return false;
+  auto i = overflow_.find(key);
+  if (i == overflow_.end())
+    return false;
+  result = std::move(i->second);
+  overflow_.erase(i);
+  --size_;
+  return true;
+}
+
+bool response_handler_table::erase(message_id id) {
+  behavior tmp;
+  return take(id, tmp);
+}
+
+void response_handler_table::clear() noexcept {
+  slots_.clear();
+  slots_.shrink_to_fit();
+  overflow_.clear();
+  size_ = 0;
+}
+
+// -- helper functions ---------------------------------------------------------
+
+void response_handler_table::grow() {
+  std::vector<slot> tmp;
+  tmp.swap(slots_);
+  slots_.resize(tmp.empty() ? min_capacity : tmp.size() * 2);
+  // Keys in distinct slots remain in distinct slots after doubling.
+  for (auto& x : tmp) {
+    if (x.key != 0) {
+      auto& y = slot_of(x.key);
+      y.key = x.key;
+      y.value = std::move(x.value);
+    }
+  }
+  // Move overflowing handlers back into the slots if possible.
+  for (auto i = overflow_.begin(); i != overflow_.end();) {
+    if (auto& y = slot_of(i->first); y.key == 0) {
+      y.key = i->first;
+      y.value = std::move(i->second);
+      i = overflow_.erase(i);
+    } else {
+      ++i;
+    }
+  }
+}
+
+} // namespace caf::detail
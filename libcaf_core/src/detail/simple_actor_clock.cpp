@@ -30,6 +30,11 @@ void simple_actor_clock::set_request_timeout(time_point t, abstract_actor* self,
   new_schedule_entry<request_timeout>(t, self->ctrl(), id);
 }
 
+void simple_actor_clock::set_request_group_timeout(
+  time_point t, abstract_actor* self, std::vector<message_id> ids) {
+  new_schedule_entry<request_timeout>(t, self->ctrl(), std::move(ids));
+}
+
 void simple_actor_clock::cancel_ordinary_timeout(abstract_actor* self,
                                                  std::string type) {
   ordinary_timeout_cancellation tmp{self->id(), std::move(type)};
@@ -65,35 +70,39 @@ void simple_actor_clock::schedule_message(time_point t, group target,
 }
 
 void simple_actor_clock::cancel_all() {
-  actor_lookup_.clear();
-  schedule_.clear();
+  clear_schedule();
 }
 
-void simple_actor_clock::ship(delayed_event& x) {
+void simple_actor_clock::ship(delayed_event& x, execution_unit* ctx) {
   switch (x.subtype) {
     case ordinary_timeout_type: {
       auto& dref = static_cast<ordinary_timeout&>(x);
       auto& self = dref.self;
-      self->get()->eq_impl(make_message_id(), self, nullptr,
+      self->get()->eq_impl(make_message_id(), self, ctx,
                            timeout_msg{dref.type, dref.id});
       break;
     }
     case multi_timeout_type: {
       auto& dref = static_cast<multi_timeout&>(x);
       auto& self = dref.self;
-      self->get()->eq_impl(make_message_id(), self, nullptr,
+      self->get()->eq_impl(make_message_id(), self, ctx,
                            timeout_msg{dref.type, dref.id});
       break;
     }
     case request_timeout_type: {
       auto& dref = static_cast<request_timeout&>(x);
       auto& self = dref.self;
-      self->get()->eq_impl(dref.id, self, nullptr, sec::request_timeout);
+      if (dref.group.empty()) {
+        self->get()->eq_impl(dref.id, self, ctx, sec::request_timeout);
+      } else {
+        for (auto id : dref.group)
+          self->get()->eq_impl(id, self, ctx, sec::request_timeout);
+      }
       break;
     }
     case actor_msg_type: {
       auto& dref = static_cast<actor_msg&>(x);
-      dref.receiver->enqueue(std::move(dref.content), nullptr);
+      dref.receiver->enqueue(std::move(dref.content), ctx);
       break;
     }
     case group_msg_type: {
@@ -101,7 +110,7 @@ void simple_actor_clock::ship(delayed_event& x) {
       auto dst = dref.target->get();
       if (dst)
         dst->enqueue(std::move(dref.sender), make_message_id(),
-                     std::move(dref.content), nullptr);
+                     std::move(dref.content), ctx);
       break;
     }
     default:
@@ -147,6 +156,17 @@ void simple_actor_clock::handle(const timeouts_cancellation& x) {
   actor_lookup_.erase(range.first, range.second);
 }
 
+void simple_actor_clock::clear_schedule() {
+  actor_lookup_.clear();
+  schedule_.clear();
+}
+
+optional<actor_clock::time_point> simple_actor_clock::next_timeout() const {
+  if (schedule_.empty())
+    return none;
+  return schedule_.begin()->first;
+}
+
 size_t simple_actor_clock::trigger_expired_timeouts() {
   size_t result = 0;
   auto t = now();
@@ -4,6 +4,8 @@
 
 #include "caf/detail/thread_safe_actor_clock.hpp"
 
+#include <algorithm>
+
 #include "caf/actor_control_block.hpp"
 #include "caf/logger.hpp"
 #include "caf/sec.hpp"
@@ -11,48 +13,105 @@
 
 namespace caf::detail {
 
+namespace {
+
+// Binds a timer shard to a clock for the current thread.
+struct shard_binding {
+  const thread_safe_actor_clock* owner = nullptr;
+  thread_safe_actor_clock::shard_inbox* inbox = nullptr;
+};
+
+thread_local shard_binding local_binding;
+
+} // namespace
+
 void thread_safe_actor_clock::set_ordinary_timeout(time_point t,
                                                    abstract_actor* self,
                                                    std::string type,
                                                    uint64_t id) {
-  push(new ordinary_timeout(t, self->ctrl(), type, id));
+  if (auto shard = local_shard()) {
+    self->setf(abstract_actor::has_worker_timers_flag);
+    shard->set_ordinary_timeout(t, self, std::move(type), id);
+  } else
+    push(new ordinary_timeout(t, self->ctrl(), type, id));
 }
 
 void thread_safe_actor_clock::set_request_timeout(time_point t,
                                                   abstract_actor* self,
                                                   message_id id) {
-  push(new request_timeout(t, self->ctrl(), id));
+  if (auto shard = local_shard()) {
+    self->setf(abstract_actor::has_worker_timers_flag);
+    shard->set_request_timeout(t, self, id);
+  } else
+    push(new request_timeout(t, self->ctrl(), id));
+}
+
+void thread_safe_actor_clock::set_request_group_timeout(
+  time_point t, abstract_actor* self, std::vector<message_id> ids) {
+  if (auto shard = local_shard()) {
+    self->setf(abstract_actor::has_worker_timers_flag);
+    shard->set_request_group_timeout(t, self, std::move(ids));
+  } else
+    push(new request_timeout(t, self->ctrl(), std::move(ids)));
 }
 
 void thread_safe_actor_clock::set_multi_timeout(time_point t,
                                                 abstract_actor* self,
                                                 std::string type, uint64_t id) {
-  push(new multi_timeout(t, self->ctrl(), type, id));
+  if (auto shard = local_shard()) {
+    self->setf(abstract_actor::has_worker_timers_flag);
+    shard->set_multi_timeout(t, self, std::move(type), id);
+  } else
+    push(new multi_timeout(t, self->ctrl(), type, id));
 }
 
 void thread_safe_actor_clock::cancel_ordinary_timeout(abstract_actor* self,
                                                       std::string type) {
+  if (auto shard = local_shard())
+    shard->cancel_ordinary_timeout(self, type);
   push(new ordinary_timeout_cancellation(self->id(), type));
 }
 
 void thread_safe_actor_clock::cancel_request_timeout(abstract_actor* self,
                                                      message_id id) {
+  if (auto shard = local_shard())
+    shard->cancel_request_timeout(self, id);
   push(new request_timeout_cancellation(self->id(), id));
 }
 
 void thread_safe_actor_clock::cancel_timeouts(abstract_actor* self) {
+  auto shard = local_shard();
+  if (shard != nullptr)
+    shard->cancel_timeouts(self);
+  // The actor may have set timeouts while running on other workers. Their
+  // entries hold a strong reference to the actor, so we must not wait for
+  // them to expire.
+  if (self->getf(abstract_actor::has_worker_timers_flag)) {
+    std::unique_lock<std::mutex> guard{shards_mtx_};
+    for (auto& inbox : shards_)
+      if (inbox->shard != shard)
+        inbox->queue.push_front(new timeouts_cancellation(self->id()));
+  }
   push(new timeouts_cancellation(self->id()));
 }
 
 void thread_safe_actor_clock::schedule_message(time_point t,
                                                strong_actor_ptr receiver,
                                                mailbox_element_ptr content) {
-  push(new actor_msg(t, std::move(receiver), std::move(content)));
+  if (auto shard = local_shard())
+    shard->schedule_message(t, std::move(receiver), std::move(content));
+  else
+    push(new actor_msg(t, std::move(receiver), std::move(content)));
 }
 
 void thread_safe_actor_clock::schedule_message(time_point t, group target,
                                                strong_actor_ptr sender,
                                                message content) {
+  if (auto shard = local_shard()) {
+    shard->schedule_message(t, std::move(target), std::move(sender),
+                            std::move(content));
+    return;
+  }
   auto ptr = new group_msg(t, std::move(target), std::move(sender),
                            std::move(content));
   push(ptr);
@@ -62,72 +121,119 @@ void thread_safe_actor_clock::cancel_all() {
   push(new drop_all);
 }
 
+void thread_safe_actor_clock::bind_local_shard(
+  timing_wheel_actor_clock* shard) {
+  std::unique_lock<std::mutex> guard{shards_mtx_};
+  if (local_binding.owner == this) {
+    auto pred = [](auto& ptr) { return ptr.get() == local_binding.inbox; };
+    shards_.erase(std::find_if(shards_.begin(), shards_.end(), pred));
+    local_binding = shard_binding{};
+  }
+  if (shard != nullptr) {
+    shards_.emplace_back(std::make_unique<shard_inbox>(shard));
+    local_binding = shard_binding{this, shards_.back().get()};
+  }
+}
+
+size_t thread_safe_actor_clock::handle_remote_cancellations() {
+  if (local_binding.owner != this || local_binding.inbox->queue.empty())
+    return 0;
+  auto inbox = local_binding.inbox;
+  size_t result = 0;
+  for (auto ptr = inbox->queue.take_head(); ptr != nullptr; ++result) {
+    unique_event_ptr x{ptr};
+    ptr = event_queue::promote(x->next);
+    CAF_ASSERT(x->subtype == timeouts_cancellation_type);
+    inbox->shard->handle(static_cast<timeouts_cancellation&>(*x));
+  }
+  return result;
+}
+
+void thread_safe_actor_clock::use_timing_wheel(timespan resolution) {
+  wheel_.reset(new timing_wheel_actor_clock(resolution));
+}
+
 void thread_safe_actor_clock::run_dispatch_loop() {
+  if (wheel_)
+    run_dispatch_loop(*wheel_);
+  else
+    run_dispatch_loop(*this);
+}
+
+template <class Backend>
+void thread_safe_actor_clock::run_dispatch_loop(Backend& backend) {
   for (;;) {
     // Wait until queue is non-empty.
-    if (schedule_.empty()) {
-      queue_.wait_nonempty();
-    } else {
-      auto t = schedule_.begin()->second->due;
-      if (!queue_.wait_nonempty(t)) {
+    if (auto t = backend.next_timeout()) {
+      if (!queue_.synchronized_await(mtx_, cv_, *t)) {
         // Handle timeout by shipping timed-out events and starting anew.
-        trigger_expired_timeouts();
+        backend.trigger_expired_timeouts();
         continue;
       }
+    } else {
+      queue_.synchronized_await(mtx_, cv_);
     }
-    // Push all elements from the queue to the events buffer.
-    auto i = events_.begin();
-    auto e = queue_.get_all(i);
-    for (; i != e; ++i) {
-      auto& x = *i;
-      CAF_ASSERT(x != nullptr);
+    // Take all events from the queue at once and restore their FIFO order,
+    // since producers push to the front of the queue.
+    event* head = nullptr;
+    for (auto ptr = queue_.take_head(); ptr != nullptr;) {
+      auto next = event_queue::promote(ptr->next);
+      ptr->next = head;
+      head = ptr;
+      ptr = next;
+    }
+    while (head != nullptr) {
+      unique_event_ptr x{head};
+      head = event_queue::promote(x->next);
       switch (x->subtype) {
         case ordinary_timeout_cancellation_type: {
-          handle(static_cast<ordinary_timeout_cancellation&>(*x));
+          backend.handle(static_cast<ordinary_timeout_cancellation&>(*x));
           break;
         }
         case request_timeout_cancellation_type: {
-          handle(static_cast<request_timeout_cancellation&>(*x));
+          backend.handle(static_cast<request_timeout_cancellation&>(*x));
           break;
         }
         case timeouts_cancellation_type: {
-          handle(static_cast<timeouts_cancellation&>(*x));
+          backend.handle(static_cast<timeouts_cancellation&>(*x));
           break;
         }
         case drop_all_type: {
-          schedule_.clear();
-          actor_lookup_.clear();
+          backend.clear_schedule();
           break;
         }
         case shutdown_type: {
-          schedule_.clear();
-          actor_lookup_.clear();
+          backend.clear_schedule();
+          while (head != nullptr) {
+            unique_event_ptr tmp{head};
+            head = event_queue::promote(tmp->next);
+          }
           // Call it a day.
           return;
         }
         case ordinary_timeout_type: {
           auto dptr = static_cast<ordinary_timeout*>(x.release());
-          add_schedule_entry(std::unique_ptr<ordinary_timeout>{dptr});
+          backend.add_schedule_entry(std::unique_ptr<ordinary_timeout>{dptr});
           break;
         }
         case multi_timeout_type: {
           auto dptr = static_cast<multi_timeout*>(x.release());
-          add_schedule_entry(std::unique_ptr<multi_timeout>{dptr});
+          backend.add_schedule_entry(std::unique_ptr<multi_timeout>{dptr});
           break;
         }
         case request_timeout_type: {
           auto dptr = static_cast<request_timeout*>(x.release());
-          add_schedule_entry(std::unique_ptr<request_timeout>{dptr});
+          backend.add_schedule_entry(std::unique_ptr<request_timeout>{dptr});
           break;
         }
         case actor_msg_type: {
           auto dptr = static_cast<actor_msg*>(x.release());
-          add_schedule_entry(std::unique_ptr<actor_msg>{dptr});
+          backend.add_schedule_entry(std::unique_ptr<actor_msg>{dptr});
           break;
         }
         case group_msg_type: {
           auto dptr = static_cast<group_msg*>(x.release());
-          add_schedule_entry(std::unique_ptr<group_msg>{dptr});
+          backend.add_schedule_entry(std::unique_ptr<group_msg>{dptr});
           break;
         }
         default: {
@@ -135,7 +241,6 @@ void thread_safe_actor_clock::run_dispatch_loop() {
           break;
         }
       }
-      x.reset();
     }
   }
 }
@@ -144,8 +249,13 @@ void thread_safe_actor_clock::cancel_dispatch_loop() {
   push(new shutdown);
 }
 
+timing_wheel_actor_clock*
+thread_safe_actor_clock::local_shard() const noexcept {
+  return local_binding.owner == this ? local_binding.inbox->shard : nullptr;
+}
+
 void thread_safe_actor_clock::push(event* ptr) {
-  queue_.push_back(unique_event_ptr{ptr});
+  queue_.synchronized_push_front(mtx_, cv_, ptr);
 }
 
 } // namespace caf::detail
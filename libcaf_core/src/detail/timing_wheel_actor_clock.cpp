@@ -0,0 +1,478 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/master/LICENSE.
+
+#include "caf/detail/timing_wheel_actor_clock.hpp"
+
+#include <functional>
+
+#include "caf/abstract_actor.hpp"
+#include "caf/actor_control_block.hpp"
+#include "caf/config.hpp"
+
+namespace caf::detail {
+
+namespace {
+
+using tick_type = timing_wheel_actor_clock::tick_type;
+
+constexpr size_t first_level_slots
+  = size_t{1} << timing_wheel_actor_clock::first_level_bits;
+
+constexpr size_t level_slots = size_t{1}
+                               << timing_wheel_actor_clock::level_bits;
+
+// Returns how many bits of a tick select the slots on level `n`.
+constexpr size_t shift_of(size_t n) noexcept {
+  return n == 0 ? 0
+                : timing_wheel_actor_clock::first_level_bits
+                    + (n - 1) * timing_wheel_actor_clock::level_bits;
+}
+
+// Returns the index of the first slot on level `n`.
+constexpr size_t offset_of(size_t n) noexcept {
+  return n == 0 ? 0 : first_level_slots + (n - 1) * level_slots;
+}
+
+// Returns the number of slots on level `n`.
+constexpr size_t slots_of(size_t n) noexcept {
+  return n == 0 ? first_level_slots : level_slots;
+}
+
+// Returns the level of the slot with index `slot`.
+constexpr size_t level_of(size_t slot) noexcept {
+  return slot < first_level_slots ? 0
+                                  : 1 + (slot - first_level_slots) / level_slots;
+}
+
+// Returns the actor that owns a cancellable event.
+actor_id owner_of(const simple_actor_clock::delayed_event& x) {
+  using clock = simple_actor_clock;
+  switch (x.subtype) {
+    case clock::ordinary_timeout_type:
+      return static_cast<const clock::ordinary_timeout&>(x).self->id();
+    case clock::multi_timeout_type:
+      return static_cast<const clock::multi_timeout&>(x).self->id();
+    case clock::request_timeout_type:
+      return static_cast<const clock::request_timeout&>(x).self->id();
+    default:
+      return invalid_actor_id;
+  }
+}
+
+bool is_cancellable(const simple_actor_clock::delayed_event& x) {
+  using clock = simple_actor_clock;
+  switch (x.subtype) {
+    case clock::ordinary_timeout_type:
+    case clock::multi_timeout_type:
+    case clock::request_timeout_type:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Adds `x` to the front of the intrusive per-actor list starting at `head`.
+void push_front(simple_actor_clock::delayed_event*& head,
+                simple_actor_clock::delayed_event* x) {
+  x->actor_prev = nullptr;
+  x->actor_next = head;
+  if (head != nullptr)
+    head->actor_prev = x;
+  head = x;
+}
+
+// Removes `x` from the intrusive per-actor list starting at `head`.
+void remove(simple_actor_clock::delayed_event*& head,
+            simple_actor_clock::delayed_event* x) {
+  if (x->actor_prev != nullptr)
+    x->actor_prev->actor_next = x->actor_next;
+  else
+    head = x->actor_next;
+  if (x->actor_next != nullptr)
+    x->actor_next->actor_prev = x->actor_prev;
+  x->actor_prev = nullptr;
+  x->actor_next = nullptr;
+}
+
+} // namespace
+
+// -- constructors, destructors, and assignment operators ----------------------
+
+timing_wheel_actor_clock::timing_wheel_actor_clock(timespan resolution)
+  : resolution_(resolution) {
+  if (resolution_.count() <= 0)
+    resolution_ = timespan{1};
+}
+
+timing_wheel_actor_clock::~timing_wheel_actor_clock() {
+  clear_schedule();
+}
+
+// -- convenience functions ----------------------------------------------------
+
+size_t
+timing_wheel_actor_clock::trigger_expired_timeouts(execution_unit* ctx) {
+  size_t result = 0;
+  auto target = to_tick(now());
+  for (;;) {
+    auto next = next_tick();
+    if (!next || *next > target) {
+      // No slot becomes due before `target`, i.e., skipping ahead leaves all
+      // events in their slot.
+      if (cur_ < target)
+        cur_ = target;
+      return result;
+    }
+    cur_ = *next;
+    cascade();
+    result += fire(ctx);
+  }
+}
+
+optional<actor_clock::time_point>
+timing_wheel_actor_clock::next_timeout() const {
+  if (auto tick = next_tick())
+    return to_time_point(*tick);
+  return none;
+}
+
+void timing_wheel_actor_clock::handle(const ordinary_timeout_cancellation& x) {
+  auto i = actor_lookup_.find(x.aid);
+  if (i == actor_lookup_.end())
+    return;
+  for (auto ptr = i->second.timeouts; ptr != nullptr; ptr = ptr->actor_next) {
+    if (ptr->subtype == simple_actor_clock::ordinary_timeout_type
+        && static_cast<ordinary_timeout*>(ptr)->type == x.type) {
+      erase(ptr);
+      return;
+    }
+  }
+}
+
+void timing_wheel_actor_clock::handle(const multi_timeout_cancellation& x) {
+  auto i = actor_lookup_.find(x.aid);
+  if (i == actor_lookup_.end())
+    return;
+  for (auto ptr = i->second.timeouts; ptr != nullptr; ptr = ptr->actor_next) {
+    if (ptr->subtype == simple_actor_clock::multi_timeout_type) {
+      auto dptr = static_cast<multi_timeout*>(ptr);
+      if (dptr->type == x.type && dptr->id == x.id) {
+        erase(ptr);
+        return;
+      }
+    }
+  }
+}
+
+void timing_wheel_actor_clock::handle(const request_timeout_cancellation& x) {
+  auto i = request_lookup_.find(request_key{x.aid, x.id.integer_value()});
+  if (i != request_lookup_.end())
+    erase(i->second);
+}
+
+void timing_wheel_actor_clock::handle(const timeouts_cancellation& x) {
+  auto i = actor_lookup_.find(x.aid);
+  if (i == actor_lookup_.end())
+    return;
+  // Drop the index entry up front, since we destroy all events of the actor.
+  auto events = i->second;
+  actor_lookup_.erase(i);
+  for (auto head : {events.timeouts, events.requests}) {
+    while (head != nullptr) {
+      auto next = head->actor_next;
+      if (head->subtype == simple_actor_clock::request_timeout_type) {
+        auto& dref = static_cast<request_timeout&>(*head);
+        request_lookup_.erase(request_key{x.aid, dref.id.integer_value()});
+      }
+      unlink_slot(head);
+      delete head;
+      head = next;
+    }
+  }
+}
+
+void timing_wheel_actor_clock::clear_schedule() {
+  actor_lookup_.clear();
+  request_lookup_.clear();
+  for (auto& slot : slots_) {
+    auto ptr = slot.head;
+    while (ptr != nullptr) {
+      auto next = ptr->slot_next;
+      delete ptr;
+      ptr = next;
+    }
+    slot = slot_list{};
+  }
+  level_sizes_.fill(0);
+  size_ = 0;
+}
+
+// -- overridden member functions ----------------------------------------------
+
+void timing_wheel_actor_clock::set_ordinary_timeout(time_point t,
+                                                    abstract_actor* self,
+                                                    std::string type,
+                                                    uint64_t id) {
+  new_schedule_entry<ordinary_timeout>(t, self->ctrl(), std::move(type), id);
+}
+
+void timing_wheel_actor_clock::set_multi_timeout(time_point t,
+                                                 abstract_actor* self,
+                                                 std::string type,
+                                                 uint64_t id) {
+  new_schedule_entry<multi_timeout>(t, self->ctrl(), std::move(type), id);
+}
+
+void timing_wheel_actor_clock::set_request_timeout(time_point t,
+                                                   abstract_actor* self,
+                                                   message_id id) {
+  new_schedule_entry<request_timeout>(t, self->ctrl(), id);
+}
+
+void timing_wheel_actor_clock::set_request_group_timeout(
+  time_point t, abstract_actor* self, std::vector<message_id> ids) {
+  new_schedule_entry<request_timeout>(t, self->ctrl(), std::move(ids));
+}
+
+void timing_wheel_actor_clock::cancel_ordinary_timeout(abstract_actor* self,
+                                                       std::string type) {
+  ordinary_timeout_cancellation tmp{self->id(), std::move(type)};
+  handle(tmp);
+}
+
+void timing_wheel_actor_clock::cancel_request_timeout(abstract_actor* self,
+                                                      message_id id) {
+  request_timeout_cancellation tmp{self->id(), id};
+  handle(tmp);
+}
+
+void timing_wheel_actor_clock::cancel_timeouts(abstract_actor* self) {
+  timeouts_cancellation tmp{self->id()};
+  handle(tmp);
+}
+
+void timing_wheel_actor_clock::schedule_message(time_point t,
+                                                strong_actor_ptr receiver,
+                                                mailbox_element_ptr content) {
+  new_schedule_entry<actor_msg>(t, std::move(receiver), std::move(content));
+}
+
+void timing_wheel_actor_clock::schedule_message(time_point t, group target,
+                                                strong_actor_ptr sender,
+                                                message content) {
+  new_schedule_entry<group_msg>(t, std::move(target), std::move(sender),
+                                std::move(content));
+}
+
+void timing_wheel_actor_clock::cancel_all() {
+  clear_schedule();
+}
+
+// -- helper functions ---------------------------------------------------------
+
+size_t timing_wheel_actor_clock::request_key_hash::operator()(
+  const request_key& x) const noexcept {
+  // Request IDs of the same actor are mostly sequential, so mixing in the
+  // actor ID with a multiplicative hash is sufficient.
+  return std::hash<uint64_t>{}(x.mid ^ (x.aid * 0x9E3779B97F4A7C15ull));
+}
+
+timing_wheel_actor_clock::tick_type
+timing_wheel_actor_clock::to_due_tick(time_point t) const noexcept {
+  auto ns = std::chrono::duration_cast<timespan>(t.time_since_epoch()).count();
+  if (ns <= 0)
+    return 0;
+  auto res = resolution_.count();
+  return static_cast<tick_type>((ns + res - 1) / res);
+}
+
+timing_wheel_actor_clock::tick_type
+timing_wheel_actor_clock::to_tick(time_point t) const noexcept {
+  auto ns = std::chrono::duration_cast<timespan>(t.time_since_epoch()).count();
+  if (ns <= 0)
+    return 0;
+  return static_cast<tick_type>(ns / resolution_.count());
+}
+
+actor_clock::time_point
+timing_wheel_actor_clock::to_time_point(tick_type tick) const noexcept {
+  auto ns = timespan{static_cast<timespan::rep>(tick) * resolution_.count()};
+  return time_point{std::chrono::duration_cast<duration_type>(ns)};
+}
+
+void timing_wheel_actor_clock::insert(delayed_event* x) {
+  // An empty wheel may skip ahead to the current time right away.
+  if (size_ == 0) {
+    auto now_tick = to_tick(now());
+    if (cur_ < now_tick)
+      cur_ = now_tick;
+  }
+  if (is_cancellable(*x)) {
+    auto aid = owner_of(*x);
+    auto& events = actor_lookup_[aid];
+    switch (x->subtype) {
+      case simple_actor_clock::ordinary_timeout_type: {
+        // Only one timeout per type may be active.
+        auto& dref = static_cast<ordinary_timeout&>(*x);
+        for (auto ptr = events.timeouts; ptr != nullptr;
+             ptr = ptr->actor_next) {
+          if (ptr->subtype == simple_actor_clock::ordinary_timeout_type
+              && static_cast<ordinary_timeout*>(ptr)->type == dref.type) {
+            remove(events.timeouts, ptr);
+            unlink_slot(ptr);
+            delete ptr;
+            break;
+          }
+        }
+        push_front(events.timeouts, x);
+        break;
+      }
+      case simple_actor_clock::request_timeout_type: {
+        auto& dref = static_cast<request_timeout&>(*x);
+        auto& entry = request_lookup_[request_key{aid, dref.id.integer_value()}];
+        if (entry != nullptr) {
+          remove(events.requests, entry);
+          unlink_slot(entry);
+          delete entry;
+        }
+        entry = x;
+        push_front(events.requests, x);
+        break;
+      }
+      default:
+        push_front(events.timeouts, x);
+    }
+  }
+  auto tick = to_due_tick(x->due);
+  place(x, tick > cur_ ? tick : cur_ + 1);
+}
+
+void timing_wheel_actor_clock::place(delayed_event* x, tick_type tick) {
+  CAF_ASSERT(tick >= cur_);
+  auto delta = tick - cur_;
+  if (delta >= max_delay) {
+    // Park the event in the last level until its due time falls into range.
+    delta = max_delay - 1;
+    tick = cur_ + delta;
+  }
+  size_t level = 0;
+  while (level + 1 < num_levels
+         && delta >= (tick_type{1} << shift_of(level + 1)))
+    ++level;
+  auto index = (tick >> shift_of(level)) & (slots_of(level) - 1);
+  auto slot = offset_of(level) + static_cast<size_t>(index);
+  auto& lst = slots_[slot];
+  x->slot = slot;
+  x->slot_next = nullptr;
+  x->slot_prev = lst.tail;
+  if (lst.tail != nullptr)
+    lst.tail->slot_next = x;
+  else
+    lst.head = x;
+  lst.tail = x;
+  ++level_sizes_[level];
+  ++size_;
+}
+
+void timing_wheel_actor_clock::unlink_slot(delayed_event* x) noexcept {
+  auto& lst = slots_[x->slot];
+  if (x->slot_prev != nullptr)
+    x->slot_prev->slot_next = x->slot_next;
+  else
+    lst.head = x->slot_next;
+  if (x->slot_next != nullptr)
+    x->slot_next->slot_prev = x->slot_prev;
+  else
+    lst.tail = x->slot_prev;
+  x->slot_prev = nullptr;
+  x->slot_next = nullptr;
+  --level_sizes_[level_of(x->slot)];
+  --size_;
+}
+
+void timing_wheel_actor_clock::unlink_actor(delayed_event* x) {
+  if (!is_cancellable(*x))
+    return;
+  auto aid = owner_of(*x);
+  auto i = actor_lookup_.find(aid);
+  if (i == actor_lookup_.end())
+    return;
+  auto& events = i->second;
+  if (x->subtype == simple_actor_clock::request_timeout_type) {
+    auto& dref = static_cast<request_timeout&>(*x);
+    request_lookup_.erase(request_key{aid, dref.id.integer_value()});
+    remove(events.requests, x);
+  } else {
+    remove(events.timeouts, x);
+  }
+  if (events.timeouts == nullptr && events.requests == nullptr)
+    actor_lookup_.erase(i);
+}
+
+void timing_wheel_actor_clock::erase(delayed_event* x) {
+  unlink_actor(x);
+  unlink_slot(x);
+  delete x;
+}
+
+optional<timing_wheel_actor_clock::tick_type>
+timing_wheel_actor_clock::next_tick() const noexcept {
+  optional<tick_type> result;
+  for (size_t level = 0; level < num_levels; ++level) {
+    if (level_sizes_[level] == 0)
+      continue;
+    // Scan the slots in the order the clock visits them. A slot on level `n`
+    // becomes due when the current tick reaches its first tick.
+    auto shift = shift_of(level);
+    auto base = cur_ >> shift;
+    for (tick_type i = 1; i <= slots_of(level); ++i) {
+      auto tick = (base + i) << shift;
+      auto index = (base + i) & (slots_of(level) - 1);
+      if (slots_[offset_of(level) + static_cast<size_t>(index)].head
+          != nullptr) {
+        if (!result || tick < *result)
+          result = tick;
+        break;
+      }
+    }
+  }
+  return result;
+}
+
+void timing_wheel_actor_clock::cascade() {
+  // Move events down from the top to allow events of upper levels to end up in
+  // a lower-level slot that we process afterwards.
+  for (auto level = num_levels - 1; level > 0; --level) {
+    auto shift = shift_of(level);
+    if (level_sizes_[level] == 0 || (cur_ & ((tick_type{1} << shift) - 1)) != 0)
+      continue;
+    auto index = (cur_ >> shift) & (slots_of(level) - 1);
+    auto& lst = slots_[offset_of(level) + static_cast<size_t>(index)];
+    auto ptr = lst.head;
+    lst = slot_list{};
+    while (ptr != nullptr) {
+      auto next = ptr->slot_next;
+      --level_sizes_[level];
+      --size_;
+      auto tick = to_due_tick(ptr->due);
+      place(ptr, tick > cur_ ? tick : cur_);
+      ptr = next;
+    }
+  }
+}
+
+size_t timing_wheel_actor_clock::fire(execution_unit* ctx) {
+  size_t result = 0;
+  auto& lst = slots_[static_cast<size_t>(cur_ & (first_level_slots - 1))];
+  while (lst.head != nullptr) {
+    std::unique_ptr<delayed_event> ptr{lst.head};
+    unlink_actor(ptr.get());
+    unlink_slot(ptr.get());
+    simple_actor_clock::ship(*ptr, ctx);
+    ++result;
+  }
+  return result;
+}
+
+} // namespace caf::detail
@@ -39,6 +39,11 @@ local_actor::metrics_t make_instance_metrics(local_actor* self) {
       nullptr,
       nullptr,
       nullptr,
+      nullptr,
+      nullptr,
+      nullptr,
+      nullptr,
+      nullptr,
     };
   self->setf(abstract_actor::collects_metrics_flag);
   const auto& families = sys.actor_metric_families();
@@ -47,6 +52,11 @@ local_actor::metrics_t make_instance_metrics(local_actor* self) {
     families.processing_time->get_or_add({{"name", sv}}),
     families.mailbox_time->get_or_add({{"name", sv}}),
     families.mailbox_size->get_or_add({{"name", sv}}),
+    families.mailbox_drops->get_or_add({{"name", sv}}),
+    families.time_slice_overruns->get_or_add({{"name", sv}}),
+    families.hibernating_actors->get_or_add({{"name", sv}}),
+    families.hibernated_bytes->get_or_add({{"name", sv}}),
+    families.wakeup_time->get_or_add({{"name", sv}}),
   };
 }
 
@@ -93,6 +103,16 @@ void local_actor::request_response_timeout(timespan timeout, message_id mid) {
   clock().set_request_timeout(t, this, mid.response_id());
 }
 
+void local_actor::request_response_timeout(timespan timeout,
+                                           std::vector<message_id> ids) {
+  CAF_LOG_TRACE(CAF_ARG(timeout) << CAF_ARG(ids));
+  if (timeout == infinite)
+    return;
+  auto t = clock().now();
+  t += timeout;
+  clock().set_request_group_timeout(t, this, std::move(ids));
+}
+
 void local_actor::monitor(abstract_actor* ptr, message_priority priority) {
   if (ptr != nullptr)
     ptr->attach(
@@ -157,6 +177,14 @@ void local_actor::initialize() {
   CAF_LOG_TRACE(CAF_ARG2("id", id()) << CAF_ARG2("name", name()));
 }
 
+bool local_actor::hibernate_state(byte_buffer&) {
+  return false;
+}
+
+error local_actor::wake_up_state(const byte_buffer&) {
+  return none;
+}
+
 bool local_actor::cleanup(error&& fail_state, execution_unit* host) {
   CAF_LOG_TRACE(CAF_ARG(fail_state));
   // tell registry we're done
@@ -0,0 +1,24 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/master/LICENSE.
+
+#include "caf/policy/lock_free_work_stealing.hpp"
+
+namespace caf::policy {
+
+lock_free_work_stealing::~lock_free_work_stealing() {
+  // nop
+}
+
+lock_free_work_stealing::worker_data::worker_data(
+  scheduler::abstract_coordinator* p)
+  : work_stealing::worker_data(p) {
+  // nop
+}
+
+lock_free_work_stealing::worker_data::worker_data(const worker_data& other)
+  : work_stealing::worker_data(other) {
+  // nop: each worker starts with a fresh local queue
+}
+
+} // namespace caf::policy
@@ -7,7 +7,9 @@
 #include "caf/actor_system_config.hpp"
 #include "caf/config_value.hpp"
 #include "caf/defaults.hpp"
+#include "caf/logger.hpp"
 #include "caf/scheduler/abstract_coordinator.hpp"
+#include "caf/telemetry/metric_registry.hpp"
 
 #define CONFIG(str_name, var_name)                                             \
   get_or(p->config(), "caf.work-stealing." str_name,                           \
@@ -19,6 +21,59 @@ work_stealing::~work_stealing() {
   // nop
 }
 
+std::shared_ptr<const work_stealing::topology_data>
+work_stealing::make_topology_data(scheduler::abstract_coordinator* p) {
+  namespace sr = defaults::scheduler;
+  auto& cfg = p->config();
+  auto aware = get_or(cfg, "caf.scheduler.topology-aware-stealing",
+                      sr::topology_aware_stealing);
+  // Topology-aware stealing makes no sense if the OS may migrate workers.
+  auto pin = aware || get_or(cfg, "caf.scheduler.pin-workers", sr::pin_workers);
+  if (!pin)
+    return nullptr;
+  auto cpus = detail::cpu_topology();
+  if (cpus.empty()) {
+    CAF_LOG_WARNING("unable to discover the CPU topology: "
+                    "cannot pin workers to CPUs");
+    return nullptr;
+  }
+  auto result = std::make_shared<topology_data>();
+  // Assign workers to CPUs in topology order, i.e., fill up cache groups first
+  // and then NUMA nodes.
+  auto num_workers = p->num_workers();
+  std::vector<const detail::cpu_info*> assigned;
+  assigned.reserve(num_workers);
+  for (size_t id = 0; id < num_workers; ++id) {
+    assigned.emplace_back(&cpus[id % cpus.size()]);
+    result->cpus.emplace_back(assigned.back()->id);
+  }
+  if (aware) {
+    result->victims.resize(num_workers);
+    for (size_t thief = 0; thief < num_workers; ++thief) {
+      auto& levels = result->victims[thief];
+      auto x = assigned[thief];
+      for (size_t victim = 0; victim < num_workers; ++victim) {
+        if (victim == thief)
+          continue;
+        auto y = assigned[victim];
+        if (x->cache_group == y->cache_group)
+          levels[same_cache].emplace_back(victim);
+        else if (x->node == y->node)
+          levels[same_node].emplace_back(victim);
+        else
+          levels[remote].emplace_back(victim);
+      }
+    }
+    auto fptr = p->system().metrics().counter_family(
+      "caf.scheduler", "stolen-jobs", {"locality"},
+      "Number of jobs stolen from other workers.", "1", true);
+    result->steals[same_cache] = fptr->get_or_add({{"locality", "cache"}});
+    result->steals[same_node] = fptr->get_or_add({{"locality", "node"}});
+    result->steals[remote] = fptr->get_or_add({{"locality", "remote"}});
+  }
+  return result;
+}
+
 work_stealing::worker_data::worker_data(scheduler::abstract_coordinator* p)
   : rengine(std::random_device{}()),
     // no need to worry about wrap-around; if `p->num_workers() < 2`,
@@ -32,15 +87,19 @@ work_stealing::worker_data::worker_data(scheduler::abstract_coordinator* p)
         CONFIG("moderate-steal-interval", moderate_steal_interval),
         CONFIG("moderate-sleep-duration", moderate_sleep_duration)},
        {1, 0, CONFIG("relaxed-steal-interval", relaxed_steal_interval),
-        CONFIG("relaxed-sleep-duration", relaxed_sleep_duration)}}} {
-  // nop
+        CONFIG("relaxed-sleep-duration", relaxed_sleep_duration)}}},
+    batch_steal(CONFIG("batch-steal", batch_steal)),
+    topology(make_topology_data(p)) {
+  waitdata.avg_idle = strategies[1].sleep_duration;
 }
 
 work_stealing::worker_data::worker_data(const worker_data& other)
   : rengine(std::random_device{}()),
     uniform(other.uniform),
-    strategies(other.strategies) {
-  // nop
+    strategies(other.strategies),
+    batch_steal(other.batch_steal),
+    topology(other.topology) {
+  waitdata.avg_idle = other.waitdata.avg_idle;
 }
 
 } // namespace caf::policy
@@ -15,6 +15,9 @@
 #include "caf/inbound_path.hpp"
 #include "caf/scheduler/abstract_coordinator.hpp"
 
+#include <algorithm>
+#include <limits>
+
 using namespace std::string_literals;
 
 namespace caf {
@@ -58,6 +61,32 @@ skippable_result drop_after_quit(scheduled_actor* self, message&) {
   return make_message();
 }
 
+// Bounces requests while draining a closed mailbox and counts how many of the
+// drained messages were subject to the mailbox capacity.
+struct mailbox_drainer {
+  const scheduled_actor* self;
+  detail::sync_request_bouncer bounce;
+  size_t bounded_messages = 0;
+
+  intrusive::task_result operator()(const mailbox_element& x) {
+    if (self->is_bounded_message(x))
+      ++bounded_messages;
+    return bounce(x);
+  }
+
+  template <class Key, class Queue, class... Ts>
+  intrusive::task_result operator()(const Key&, const Queue&, const Ts&... xs) {
+    (*this)(xs...);
+    return intrusive::task_result::resume;
+  }
+};
+
+bool is_hibernation_timeout(const mailbox_element& x) {
+  auto& content = x.content();
+  return content.match_elements<timeout_msg>()
+         && content.get_as<timeout_msg>(0).type == "hibernate";
+}
+
 } // namespace
 
 // -- static helper functions --------------------------------------------------
@@ -108,21 +137,32 @@ error scheduled_actor::default_exception_handler(local_actor* ptr,
 
 // -- constructors and destructors ---------------------------------------------
 
-scheduled_actor::scheduled_actor(actor_config& cfg)
-  : super(cfg),
-    mailbox_(unit, unit, unit, unit, unit),
-    timeout_id_(0),
-    default_handler_(print_and_drop),
-    error_handler_(default_error_handler),
-    down_handler_(default_down_handler),
-    node_down_handler_(default_node_down_handler),
-    exit_handler_(default_exit_handler),
-    private_thread_(nullptr)
+scheduled_actor::cold_state::cold_state()
+  : default_fun(print_and_drop),
+    error_fun(default_error_handler),
+    down_fun(default_down_handler),
+    node_down_fun(default_node_down_handler),
+    exit_fun(default_exit_handler)
 #ifdef CAF_ENABLE_EXCEPTIONS
     ,
-    exception_handler_(default_exception_handler)
+    exception_fun(default_exception_handler)
 #endif // CAF_ENABLE_EXCEPTIONS
 {
+  // nop
+}
+
+scheduled_actor::scheduled_actor(actor_config& cfg)
+  : super(cfg),
+    mailbox_(unit, unit, unit, unit, unit),
+    timeout_id_(0),
+    private_thread_(nullptr),
+    mailbox_capacity_(cfg.mailbox_capacity),
+    overflow_policy_(cfg.overflow_policy),
+    mailbox_depth_(0),
+    hibernation_timeout_(infinite),
+    hibernation_activity_(false),
+    hibernating_(false),
+    message_cost_(0) {
   auto& sys_cfg = home_system().config();
   max_batch_delay_ = get_or(sys_cfg, "caf.stream.max_batch_delay",
                             defaults::stream::max_batch_delay);
@@ -141,6 +181,18 @@ void scheduled_actor::enqueue(mailbox_element_ptr ptr, execution_unit* eu) {
   CAF_LOG_SEND_EVENT(ptr);
   auto mid = ptr->mid;
   auto sender = ptr->sender;
+  auto bounded = mailbox_capacity_ > 0 && is_bounded_message(*ptr);
+  if (bounded) {
+    auto depth = mailbox_depth_.fetch_add(1, std::memory_order_relaxed);
+    if (depth >= mailbox_capacity_
+        && (overflow_policy_ == mailbox_overflow_policy::drop_newest
+            || overflow_policy_ == mailbox_overflow_policy::reject)) {
+      mailbox_depth_.fetch_sub(1, std::memory_order_relaxed);
+      drop_overflow(std::move(ptr), eu,
+                    overflow_policy_ == mailbox_overflow_policy::reject);
+      return;
+    }
+  }
   auto collects_metrics = getf(abstract_actor::collects_metrics_flag);
   if (collects_metrics) {
     ptr->set_enqueue_time();
@@ -161,6 +213,8 @@ void scheduled_actor::enqueue(mailbox_element_ptr ptr, execution_unit* eu) {
     case intrusive::inbox_result::queue_closed: {
       CAF_LOG_REJECT_EVENT();
       home_system().base_metrics().rejected_messages->inc();
+      if (bounded)
+        mailbox_depth_.fetch_sub(1, std::memory_order_relaxed);
       if (collects_metrics)
         metrics_.mailbox_size->dec();
       if (mid.is_request()) {
@@ -176,6 +230,69 @@ void scheduled_actor::enqueue(mailbox_element_ptr ptr, execution_unit* eu) {
   }
 }
 
+void scheduled_actor::enqueue_batch(mailbox_element_ptr first,
+                                    execution_unit* eu) {
+  CAF_ASSERT(first != nullptr);
+  CAF_ASSERT(!getf(is_blocking_flag));
+  CAF_LOG_TRACE("");
+  // Bounded mailboxes need to check each element individually.
+  if (mailbox_capacity_ > 0) {
+    abstract_actor::enqueue_batch(std::move(first), eu);
+    return;
+  }
+  auto collects_metrics = getf(abstract_actor::collects_metrics_flag);
+  int64_t count = 0;
+  for (auto ptr = first.get(); ptr != nullptr;
+       ptr = static_cast<mailbox_element*>(ptr->next)) {
+    CAF_LOG_SEND_EVENT(ptr);
+    if (collects_metrics)
+      ptr->set_enqueue_time();
+    ++count;
+  }
+  if (collects_metrics)
+    metrics_.mailbox_size->inc(count);
+  switch (mailbox().push_back_chain(first.get())) {
+    case intrusive::inbox_result::unblocked_reader: {
+      first.release();
+      CAF_LOG_ACCEPT_EVENT(true);
+      intrusive_ptr_add_ref(ctrl());
+      if (private_thread_)
+        private_thread_->resume(this);
+      else if (eu != nullptr)
+        eu->exec_later(this);
+      else
+        home_system().scheduler().enqueue(this);
+      break;
+    }
+    case intrusive::inbox_result::queue_closed: {
+      CAF_LOG_REJECT_EVENT();
+      home_system().base_metrics().rejected_messages->inc(count);
+      if (collects_metrics)
+        metrics_.mailbox_size->dec(count);
+      detail::sync_request_bouncer f{exit_reason()};
+      while (first != nullptr) {
+        mailbox_element_ptr next{static_cast<mailbox_element*>(first->next)};
+        first->next = nullptr;
+        if (first->mid.is_request())
+          f(first->sender, first->mid);
+        first = std::move(next);
+      }
+      break;
+    }
+    case intrusive::inbox_result::success:
+      // enqueued to a running actors' mailbox; nothing to do
+      first.release();
+      CAF_LOG_ACCEPT_EVENT(false);
+      break;
+  }
+}
+
+bool scheduled_actor::mailbox_congested() const noexcept {
+  return mailbox_capacity_ > 0
+         && mailbox_depth_.load(std::memory_order_relaxed)
+              >= mailbox_capacity_;
+}
+
 mailbox_element* scheduled_actor::peek_at_next_mailbox_element() {
   if (mailbox().closed() || mailbox().blocked()) {
     return nullptr;
@@ -190,6 +307,13 @@ mailbox_element* scheduled_actor::peek_at_next_mailbox_element() {
 
 // -- overridden functions of local_actor --------------------------------------
 
+void scheduled_actor::on_destroy() {
+  // Restore the state first, because `on_exit` expects a valid state.
+  if (hibernating_)
+    wake_up();
+  super::on_destroy();
+}
+
 const char* scheduled_actor::name() const {
   return "user.scheduled-actor";
 }
@@ -235,15 +359,18 @@ bool scheduled_actor::cleanup(error&& fail_state, execution_unit* host) {
     mailbox_.close();
     get_normal_queue().flush_cache();
     get_urgent_queue().flush_cache();
-    detail::sync_request_bouncer bounce{fail_state};
-    auto dropped = mailbox_.queue().new_round(1000, bounce).consumed_items;
+    mailbox_drainer drain{this, detail::sync_request_bouncer{fail_state}};
+    auto dropped = mailbox_.queue().new_round(1000, drain).consumed_items;
     while (dropped > 0) {
       if (getf(abstract_actor::collects_metrics_flag)) {
         auto val = static_cast<int64_t>(dropped);
         metrics_.mailbox_size->dec(val);
       }
-      dropped = mailbox_.queue().new_round(1000, bounce).consumed_items;
+      dropped = mailbox_.queue().new_round(1000, drain).consumed_items;
     }
+    if (mailbox_capacity_ > 0)
+      mailbox_depth_.fetch_sub(drain.bounded_messages,
+                               std::memory_order_relaxed);
   }
   // Dispatch to parent's `cleanup` function.
   return super::cleanup(std::move(fail_state), host);
@@ -271,6 +398,34 @@ resumable::resume_result scheduled_actor::resume(execution_unit* ctx,
     return resumable::done;
   size_t consumed = 0;
   actor_clock::time_point tout{actor_clock::duration_type{0}};
+  // With a time budget, we derive the message quota for this run from the
+  // observed cost per message and stop early once the budget runs out.
+  auto time_budget = home_system().scheduler().max_throughput_time();
+  actor_clock::time_point run_start;
+  if (time_budget.count() > 0) {
+    run_start = clock().now();
+    if (message_cost_.count() > 0) {
+      auto quota = std::max(time_budget / message_cost_, int64_t{1});
+      max_throughput = std::min(max_throughput, static_cast<size_t>(quota));
+    }
+  }
+  auto budget_exhausted = [&] {
+    return time_budget.count() > 0 && clock().now() - run_start >= time_budget;
+  };
+  auto update_message_cost = [&] {
+    if (time_budget.count() == 0 || consumed == 0)
+      return;
+    auto elapsed = std::chrono::duration_cast<timespan>(clock().now()
+                                                        - run_start);
+    auto sample = elapsed / static_cast<int64_t>(consumed);
+    // Exponential moving average that weights new samples with 1/8.
+    if (message_cost_.count() == 0)
+      message_cost_ = sample;
+    else
+      message_cost_ = (message_cost_ * 7 + sample) / 8;
+    if (elapsed > time_budget && metrics_.time_slice_overruns)
+      metrics_.time_slice_overruns->inc();
+  };
   auto reset_timeouts_if_needed = [&] {
     // Set a new receive timeout if we called our behavior at least once.
     if (consumed > 0)
@@ -282,10 +437,16 @@ resumable::resume_result scheduled_actor::resume(execution_unit* ctx,
         tout = advance_streams(clock().now());
       set_stream_timeout(tout);
     }
+    // Restart the hibernation timer if the actor processed any message.
+    if (hibernation_activity_) {
+      hibernation_activity_ = false;
+      set_hibernation_timeout();
+    }
   };
   // Callback for handling urgent and normal messages.
   auto handle_async = [this, max_throughput, &consumed](mailbox_element& x) {
-    return run_with_metrics(x, [this, max_throughput, &consumed, &x] {
+    auto bounded = mailbox_capacity_ > 0 && is_bounded_message(x);
+    auto res = run_with_metrics(x, [this, max_throughput, &consumed, &x] {
       switch (reactivate(x)) {
         case activation_result::terminated:
           return intrusive::task_result::stop;
@@ -298,6 +459,10 @@ resumable::resume_result scheduled_actor::resume(execution_unit* ctx,
           return intrusive::task_result::resume;
       }
     });
+    // Skipped messages remain in the mailbox.
+    if (bounded && res != intrusive::task_result::skip)
+      mailbox_depth_.fetch_sub(1, std::memory_order_relaxed);
+    return res;
   };
   // Callback for handling upstream messages (e.g., ACKs).
   auto handle_umsg = [this, max_throughput, &consumed](mailbox_element& x) {
@@ -378,6 +543,9 @@ resumable::resume_result scheduled_actor::resume(execution_unit* ctx,
   while (consumed < max_throughput) {
     CAF_LOG_DEBUG("start new DRR round");
     mailbox_.fetch_more();
+    if (overflow_policy_ == mailbox_overflow_policy::drop_oldest
+        && mailbox_congested())
+      drop_oldest_messages();
     auto prev = consumed; // Caches the value before processing more.
     // TODO: maybe replace '3' with configurable / adaptive value?
     static constexpr size_t quantum = 3;
@@ -418,8 +586,10 @@ resumable::resume_result scheduled_actor::resume(execution_unit* ctx,
       home_system().base_metrics().processed_messages->inc(signed_val);
     } else {
       reset_timeouts_if_needed();
-      if (mailbox().try_block())
+      if (mailbox().try_block()) {
+        update_message_cost();
         return resumable::awaiting_message;
+      }
       CAF_LOG_DEBUG("mailbox().try_block() returned false");
     }
     CAF_LOG_DEBUG("allow stream managers to send batches");
@@ -431,8 +601,11 @@ resumable::resume_result scheduled_actor::resume(execution_unit* ctx,
       return resumable::done;
     if (auto now = clock().now(); now >= tout)
       tout = advance_streams(now);
+    if (budget_exhausted())
+      break;
   }
   CAF_LOG_DEBUG("max throughput reached");
+  update_message_cost();
   reset_timeouts_if_needed();
   if (mailbox().try_block())
     return resumable::awaiting_message;
@@ -492,8 +665,8 @@ auto scheduled_actor::inbound_stream_metrics(type_id_t type)
   -> inbound_stream_metrics_t {
   if (!has_metrics_enabled())
     return {nullptr, nullptr};
-  if (auto i = inbound_stream_metrics_.find(type);
-      i != inbound_stream_metrics_.end())
+  auto& cache = cold().inbound_stream_metrics;
+  if (auto i = cache.find(type); i != cache.end())
     return i->second;
   auto actor_name_cstr = name();
   auto actor_name = string_view{actor_name_cstr, strlen(actor_name_cstr)};
@@ -503,7 +676,7 @@ auto scheduled_actor::inbound_stream_metrics(type_id_t type)
     fs.processed_elements->get_or_add({{"name", actor_name}, {"type", tname}}),
     fs.input_buffer_size->get_or_add({{"name", actor_name}, {"type", tname}}),
   };
-  inbound_stream_metrics_.emplace(type, result);
+  cache.emplace(type, result);
   return result;
 }
 
@@ -511,8 +684,8 @@ auto scheduled_actor::outbound_stream_metrics(type_id_t type)
   -> outbound_stream_metrics_t {
   if (!has_metrics_enabled())
     return {nullptr, nullptr};
-  if (auto i = outbound_stream_metrics_.find(type);
-      i != outbound_stream_metrics_.end())
+  auto& cache = cold().outbound_stream_metrics;
+  if (auto i = cache.find(type); i != cache.end())
     return i->second;
   auto actor_name_cstr = name();
   auto actor_name = string_view{actor_name_cstr, strlen(actor_name_cstr)};
@@ -522,7 +695,7 @@ auto scheduled_actor::outbound_stream_metrics(type_id_t type)
     fs.pushed_elements->get_or_add({{"name", actor_name}, {"type", tname}}),
     fs.output_buffer_size->get_or_add({{"name", actor_name}, {"type", tname}}),
   };
-  outbound_stream_metrics_.emplace(type, result);
+  cache.emplace(type, result);
   return result;
 }
 
@@ -586,6 +759,80 @@ uint64_t scheduled_actor::set_stream_timeout(actor_clock::time_point x) {
   return set_timeout("stream", x);
 }
 
+uint64_t scheduled_actor::set_hibernation_timeout() {
+  CAF_LOG_TRACE("");
+  if (hibernation_timeout_ == infinite)
+    return 0;
+  // Note: we cannot use `set_timeout`, because `timeout_id_` identifies the
+  //       active receive timeout.
+  auto id = ++cold().hibernation_timeout_id;
+  clock().set_ordinary_timeout(clock().now() + hibernation_timeout_, this,
+                               "hibernate", id);
+  return id;
+}
+
+// -- hibernation --------------------------------------------------------------
+
+void scheduled_actor::hibernate_after(timespan idle_time) {
+  CAF_LOG_TRACE(CAF_ARG(idle_time));
+  hibernation_timeout_ = idle_time;
+  if (idle_time == infinite) {
+    // Invalidate any pending hibernation timeout.
+    if (cold_)
+      ++cold_->hibernation_timeout_id;
+    hibernation_activity_ = false;
+  } else {
+    // Starts the timer after the current message handler.
+    hibernation_activity_ = true;
+  }
+}
+
+void scheduled_actor::hibernate() {
+  CAF_LOG_TRACE("");
+  CAF_ASSERT(!hibernating_);
+  // Actors that await responses or participate in streams are not idle.
+  if (!awaited_responses_.empty() || !multiplexed_responses_.empty()
+      || !stream_managers_.empty() || !pending_stream_managers_.empty())
+    return;
+  // Release caches. Dropping the map of multiplexed responses releases its
+  // table and the metrics maps refill on demand.
+  multiplexed_responses_.clear();
+  auto& cs = cold();
+  inbound_stream_metrics_map{}.swap(cs.inbound_stream_metrics);
+  outbound_stream_metrics_map{}.swap(cs.outbound_stream_metrics);
+  bhvr_stack_.cleanup();
+  // Release the state if the actor knows how to restore it later.
+  auto& buf = cs.hibernated_state;
+  if (!hibernate_state(buf))
+    buf.clear();
+  buf.shrink_to_fit();
+  hibernating_ = true;
+  CAF_LOG_DEBUG("hibernate with" << buf.size() << "bytes of state");
+  if (metrics_.hibernating_actors) {
+    metrics_.hibernating_actors->inc();
+    metrics_.hibernated_bytes->inc(static_cast<int64_t>(buf.size()));
+  }
+}
+
+void scheduled_actor::wake_up() {
+  CAF_LOG_TRACE("");
+  CAF_ASSERT(hibernating_);
+  auto t0 = std::chrono::steady_clock::now();
+  hibernating_ = false;
+  auto& buf = cold().hibernated_state;
+  auto err = wake_up_state(buf);
+  if (metrics_.hibernating_actors) {
+    metrics_.hibernating_actors->dec();
+    metrics_.hibernated_bytes->dec(static_cast<int64_t>(buf.size()));
+    telemetry::timer::observe(metrics_.wakeup_time, t0);
+  }
+  byte_buffer{}.swap(buf);
+  if (err) {
+    CAF_LOG_ERROR("failed to restore the state after hibernating:" << err);
+    quit(std::move(err));
+  }
+}
+
 // -- message processing -------------------------------------------------------
 
 void scheduled_actor::add_awaited_response_handler(message_id response_id,
@@ -632,6 +879,12 @@ scheduled_actor::categorize(mailbox_element& x) {
     } else if (tm.type == "stream") {
       CAF_LOG_DEBUG("handle stream timeout message");
       set_stream_timeout(advance_streams(clock().now()));
+    } else if (tm.type == "hibernate") {
+      CAF_LOG_DEBUG("handle hibernation timeout message");
+      if (cold_ && tid == cold_->hibernation_timeout_id
+          && !hibernation_activity_
+          && !hibernating_)
+        hibernate();
     } else {
       // Drop. Other types not supported yet.
     }
@@ -657,23 +910,24 @@ scheduled_actor::categorize(mailbox_element& x) {
       stream_managers_.clear();
       pending_stream_managers_.clear();
     } else {
-      call_handler(exit_handler_, this, em);
+      call_cold_handler(&cold_state::exit_fun, default_exit_handler, em);
     }
     return message_category::internal;
   }
   if (auto view = make_typed_message_view<down_msg>(content)) {
     auto& dm = get<0>(view);
-    call_handler(down_handler_, this, dm);
+    call_cold_handler(&cold_state::down_fun, default_down_handler, dm);
     return message_category::internal;
   }
   if (auto view = make_typed_message_view<node_down_msg>(content)) {
     auto& dm = get<0>(view);
-    call_handler(node_down_handler_, this, dm);
+    call_cold_handler(&cold_state::node_down_fun, default_node_down_handler,
+                      dm);
     return message_category::internal;
   }
   if (auto view = make_typed_message_view<error>(content)) {
     auto& err = get<0>(view);
-    call_handler(error_handler_, this, err);
+    call_error_handler(err);
     return message_category::internal;
   }
   if (content.match_elements<open_stream_msg>()) {
@@ -718,12 +972,10 @@ invoke_message_result scheduled_actor::consume(mailbox_element& x) {
     // Handle multiplexed responses.
     if (x.mid.is_response()) {
       auto invoke = select_invoke_fun();
-      auto mrh = multiplexed_responses_.find(x.mid);
+      behavior bhvr;
       // neither awaited nor multiplexed, probably an expired timeout
-      if (mrh == multiplexed_responses_.end())
+      if (!multiplexed_responses_.take(x.mid, bhvr))
         return invoke_message_result::dropped;
-      auto bhvr = std::move(mrh->second);
-      multiplexed_responses_.erase(mrh);
       if (!invoke(this, bhvr, x)) {
         CAF_LOG_DEBUG("got unexpected_response");
         auto msg = make_message(
@@ -749,7 +1001,8 @@ invoke_message_result scheduled_actor::consume(mailbox_element& x) {
           if (bhvr(visitor, x.content()))
             return invoke_message_result::consumed;
         }
-        auto sres = call_handler(default_handler_, this, x.payload);
+        auto sres = call_cold_handler(&cold_state::default_fun, print_and_drop,
+                                      x.payload);
         auto f = detail::make_overload(
           [&](auto& x) {
             visitor(x);
@@ -807,7 +1060,8 @@ bool scheduled_actor::activate(execution_unit* ctx) {
   } catch (...) {
     CAF_LOG_ERROR("actor died during initialization");
     auto eptr = std::current_exception();
-    quit(call_handler(exception_handler_, this, eptr));
+    quit(call_cold_handler(&cold_state::exception_fun,
+                           default_exception_handler, eptr));
     finalize();
     return false;
   }
@@ -828,9 +1082,16 @@ auto scheduled_actor::activate(execution_unit* ctx, mailbox_element& x)
 
 auto scheduled_actor::reactivate(mailbox_element& x) -> activation_result {
   CAF_LOG_TRACE(CAF_ARG(x));
+  // Any message except for hibernation timeouts counts as activity.
+  if (hibernation_timeout_ != infinite && !is_hibernation_timeout(x)) {
+    hibernation_activity_ = true;
+    if (hibernating_)
+      wake_up();
+  }
 #ifdef CAF_ENABLE_EXCEPTIONS
   auto handle_exception = [&](std::exception_ptr eptr) {
-    auto err = call_handler(exception_handler_, this, eptr);
+    auto err = call_cold_handler(&cold_state::exception_fun,
+                                 default_exception_handler, eptr);
     if (x.mid.is_request()) {
       auto rp = make_response_promise();
       rp.deliver(err);
@@ -926,6 +1187,72 @@ void scheduled_actor::push_to_cache(mailbox_element_ptr ptr) {
     push(std::get<urgent_queue_index>(qs));
 }
 
+void scheduled_actor::drop_overflow(mailbox_element_ptr ptr,
+                                    execution_unit* eu, bool notify_sender) {
+  CAF_LOG_DEBUG("mailbox full, drop message:" << CAF_ARG(*ptr));
+  if (getf(abstract_actor::collects_metrics_flag))
+    metrics_.mailbox_drops->inc();
+  auto& sender = ptr->sender;
+  if (sender == nullptr)
+    return;
+  if (ptr->mid.is_request())
+    sender->enqueue(strong_actor_ptr{ctrl()}, ptr->mid.response_id(),
+                    make_message(make_error(sec::mailbox_full)), eu);
+  else if (notify_sender)
+    sender->enqueue(strong_actor_ptr{ctrl()}, make_message_id(),
+                    make_message(make_error(sec::mailbox_full)), eu);
+}
+
+bool scheduled_actor::is_bounded_message(
+  const mailbox_element& x) const noexcept {
+  // Responses and stream traffic bypass the capacity. Urgent and normal
+  // messages both count towards it.
+  auto category = x.mid.category();
+  if (x.mid.is_response()
+      || (category != message_id::normal_message_category
+          && category != message_id::urgent_message_category))
+    return false;
+  // System messages bypass the capacity, since dropping them could leave the
+  // actor running after an exit message or miss its timeouts. The runtime
+  // sends them anonymously or on behalf of the actor that the message refers
+  // to, which distinguishes them from user messages with the same content.
+  auto& content = x.content();
+  auto sender = x.sender.get();
+  auto from_source = [sender](const actor_addr& source) {
+    return sender == nullptr
+           || sender == actor_cast<actor_control_block*>(source);
+  };
+  if (content.match_elements<exit_msg>())
+    return !from_source(content.get_as<exit_msg>(0).source);
+  if (content.match_elements<down_msg>())
+    return !from_source(content.get_as<down_msg>(0).source);
+  if (content.match_elements<node_down_msg>())
+    return sender != nullptr;
+  if (content.match_elements<timeout_msg>())
+    return sender != nullptr && sender != ctrl();
+  return true;
+}
+
+void scheduled_actor::drop_oldest_messages() {
+  auto& items = get_normal_queue().items();
+  auto kept = normal_queue::list_type{items.policy()};
+  while (mailbox_depth_.load(std::memory_order_relaxed) > mailbox_capacity_
+         && !items.empty()) {
+    // Take elements regardless of the deficit.
+    auto deficit = std::numeric_limits<normal_queue::deficit_type>::max();
+    auto ptr = items.next(deficit);
+    if (is_bounded_message(*ptr)) {
+      mailbox_depth_.fetch_sub(1, std::memory_order_relaxed);
+      if (getf(abstract_actor::collects_metrics_flag))
+        metrics_.mailbox_size->dec();
+      drop_overflow(std::move(ptr), context(), false);
+    } else {
+      kept.push_back(ptr.release());
+    }
+  }
+  items.prepend(kept);
+}
+
 scheduled_actor::urgent_queue& scheduled_actor::get_urgent_queue() {
   return get<urgent_queue_index>(mailbox_.queue().queues());
 }
@@ -1163,7 +1490,8 @@ scheduled_actor::handle_open_stream_msg(mailbox_element& x) {
   if (!bs.empty() && bs.back()(f, osm.msg))
     return invoke_message_result::consumed;
   CAF_LOG_DEBUG("no match in behavior, fall back to default handler");
-  auto sres = call_handler(default_handler_, this, x.payload);
+  auto sres = call_cold_handler(&cold_state::default_fun, print_and_drop,
+                                x.payload);
   if (holds_alternative<skip_t>(sres)) {
     CAF_LOG_DEBUG("default handler skipped open_stream_msg:" << osm.msg);
     return invoke_message_result::skipped;
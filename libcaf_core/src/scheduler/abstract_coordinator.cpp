@@ -43,6 +43,8 @@ using string_sink_ptr = std::shared_ptr<string_sink>;
 
 using sink_cache = std::map<std::string, string_sink_ptr>;
 
+thread_local execution_unit* current_worker;
+
 string_sink make_sink(actor_system& sys, const std::string& fn, int flags) {
   if (fn.empty()) {
     return nullptr;
@@ -187,8 +189,12 @@ void abstract_coordinator::init(actor_system_config& cfg) {
   namespace sr = defaults::scheduler;
   max_throughput_ = get_or(cfg, "caf.scheduler.max-throughput",
                            sr::max_throughput);
+  max_throughput_time_ = get_or(cfg, "caf.scheduler.max-throughput-time",
+                                sr::max_throughput_time);
   num_workers_ = get_or(cfg, "caf.scheduler.max-threads",
                         default_thread_count());
+  lifo_slot_limit_ = get_or(cfg, "caf.scheduler.lifo-slot-limit",
+                            sr::lifo_slot_limit);
 }
 
 actor_system::module::id_t abstract_coordinator::id() const {
@@ -208,7 +214,12 @@ void abstract_coordinator::stop_actors() {
 }
 
 abstract_coordinator::abstract_coordinator(actor_system& sys)
-  : next_worker_(0), max_throughput_(0), num_workers_(0), system_(sys) {
+  : next_worker_(0),
+    max_throughput_(0),
+    max_throughput_time_(0),
+    num_workers_(0),
+    lifo_slot_limit_(0),
+    system_(sys) {
   // nop
 }
 
@@ -255,4 +266,12 @@ size_t abstract_coordinator::default_thread_count() noexcept {
   return std::max(std::thread::hardware_concurrency(), 4u);
 }
 
+execution_unit* abstract_coordinator::this_worker() noexcept {
+  return current_worker;
+}
+
+void abstract_coordinator::this_worker(execution_unit* ptr) noexcept {
+  current_worker = ptr;
+}
+
 } // namespace caf::scheduler
@@ -0,0 +1,32 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/master/LICENSE.
+
+#include "caf/telemetry/importer/memory_pool.hpp"
+
+#include "caf/detail/memory_pool.hpp"
+#include "caf/telemetry/counter.hpp"
+#include "caf/telemetry/metric_registry.hpp"
+
+namespace caf::telemetry::importer {
+
+memory_pool::memory_pool(metric_registry& reg) {
+  hits_ = reg.counter_singleton("caf.memory-pool", "hits",
+                                "Number of allocations served from a free list.",
+                                "1", true);
+  misses_ = reg.counter_singleton(
+    "caf.memory-pool", "misses",
+    "Number of allocations that fell back to the system allocator.", "1", true);
+}
+
+void memory_pool::update() {
+  // The pool only publishes monotonically growing totals, but our counters may
+  // only grow by increments.
+  auto [hits, misses] = detail::memory_pool::stats();
+  hits_->inc(static_cast<int64_t>(hits - last_hits_));
+  misses_->inc(static_cast<int64_t>(misses - last_misses_));
+  last_hits_ = hits;
+  last_misses_ = misses;
+}
+
+} // namespace caf::telemetry::importer
@@ -28,7 +28,7 @@ public:
   }
 
   behavior make_behavior() override {
-    auto nested = exit_handler_;
+    exit_handler nested = default_exit_handler;
     set_exit_handler(
       [=](scheduled_actor* self, exit_msg& em) { nested(self, em); });
     return {
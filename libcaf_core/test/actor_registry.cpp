@@ -8,6 +8,9 @@
 
 #include "core-test.hpp"
 
+#include <thread>
+#include <vector>
+
 #include "caf/binary_deserializer.hpp"
 #include "caf/binary_serializer.hpp"
 
@@ -51,4 +54,31 @@ CAF_TEST(serialization roundtrips go through the registry) {
   anon_send_exit(hdl, exit_reason::user_shutdown);
 }
 
+CAF_TEST(threads access actors in all shards concurrently) {
+  auto& reg = sys.registry();
+  std::vector<actor> actors;
+  for (size_t i = 0; i < actor_registry::num_shards * 4; ++i)
+    actors.emplace_back(sys.spawn(dummy));
+  std::vector<std::thread> threads;
+  for (size_t offset = 0; offset < 4; ++offset)
+    threads.emplace_back([&reg, &actors, offset] {
+      for (size_t i = offset; i < actors.size(); i += 4) {
+        auto& hdl = actors[i];
+        reg.put(hdl->id(), hdl);
+        for (auto& other : actors)
+          reg.get<actor>(other->id());
+      }
+    });
+  for (auto& t : threads)
+    t.join();
+  for (auto& hdl : actors)
+    CHECK_EQ(reg.get<actor>(hdl->id()), hdl);
+  for (auto& hdl : actors)
+    reg.erase(hdl->id());
+  for (auto& hdl : actors) {
+    CHECK_EQ(reg.get<actor>(hdl->id()), nullptr);
+    anon_send_exit(hdl, exit_reason::user_shutdown);
+  }
+}
+
 CAF_TEST_FIXTURE_SCOPE_END()
@@ -9,7 +9,10 @@
 #include "core-test.hpp"
 #include "nasty.hpp"
 
+#include <array>
+#include <cmath>
 #include <cstring>
+#include <limits>
 #include <vector>
 
 #include "caf/actor_system.hpp"
@@ -151,6 +154,102 @@ CAF_TEST(container types) {
     CHECK_LOAD(std::set<int8_t>, std::set<int8_t>({1, 2, 4, 8}), //
                4_b, 1_b, 2_b, 4_b, 8_b);
   }
+  SUBTEST("STL arrays") {
+    using i16_array = std::array<int16_t, 3>;
+    CHECK_LOAD(i16_array, i16_array({{1, -2, 4}}), //
+               0_b, 1_b, 0xFF_b, 0xFE_b, 0_b, 4_b);
+  }
+}
+
+CAF_TEST(arithmetic sequences produce the same values as individual reads) {
+  auto save = [](const auto& xs) {
+    byte_buffer result;
+    binary_serializer sink{nullptr, result};
+    if (!sink.apply(xs))
+      CAF_FAIL("binary_serializer failed to save: " << sink.get_error());
+    return result;
+  };
+  // Runs the generic implementation that deserializes each element on its own.
+  auto load_each = [](const byte_buffer& buf, auto& xs) {
+    binary_deserializer source{nullptr, buf};
+    if (!static_cast<binary_deserializer::super&>(source).list(xs))
+      CAF_FAIL("binary_deserializer failed to load: " << source.get_error());
+  };
+  SUBTEST("integers") {
+    auto xs = std::vector<int64_t>{0, 1, -1, 0x0102030405060708,
+                                   std::numeric_limits<int64_t>::min()};
+    auto buf = save(xs);
+    CHECK_EQ(load<std::vector<int64_t>>(buf), xs);
+  }
+  SUBTEST("floating points") {
+    using limits = std::numeric_limits<double>;
+    auto xs = std::vector<double>{0.,
+                                  -0.,
+                                  -2.25e300,
+                                  limits::min(),
+                                  limits::max(),
+                                  limits::infinity(),
+                                  -limits::infinity(),
+                                  limits::quiet_NaN(),
+                                  limits::denorm_min()};
+    auto buf = save(xs);
+    auto ys = load<std::vector<double>>(buf);
+    auto zs = std::vector<double>{};
+    load_each(buf, zs);
+    CAF_REQUIRE_EQUAL(ys.size(), zs.size());
+    for (size_t index = 0; index < ys.size(); ++index) {
+      if (std::isnan(zs[index]))
+        CAF_CHECK(std::isnan(ys[index]));
+      else
+        CHECK_EQ(ys[index], zs[index]);
+    }
+    ys.resize(7);
+    CHECK_EQ(ys, std::vector<double>(xs.begin(), xs.begin() + 7));
+  }
+  SUBTEST("truncated input") {
+    auto buf = byte_buffer({3_b, 0_b, 0_b, 0_b, 1_b});
+    auto xs = std::vector<int32_t>{};
+    binary_deserializer source{nullptr, buf};
+    CAF_CHECK(!source.apply(xs));
+    CHECK_EQ(source.get_error(), sec::end_of_stream);
+  }
+}
+
+CAF_TEST(views point into the input without copying) {
+  SUBTEST("strings") {
+    byte_buffer buf;
+    binary_serializer sink{nullptr, buf};
+    CAF_CHECK(sink.apply(std::string{"hello"}));
+    CAF_CHECK(sink.apply(std::string{"world"}));
+    binary_deserializer source{nullptr, buf};
+    string_view x;
+    string_view y;
+    CAF_CHECK(source.read_view(x));
+    CAF_CHECK(source.read_view(y));
+    CHECK_EQ(x, "hello");
+    CHECK_EQ(y, "world");
+    CHECK_EQ(reinterpret_cast<const byte*>(x.data()), buf.data() + 1);
+    CHECK_EQ(source.remaining(), 0u);
+  }
+  SUBTEST("bytes") {
+    auto blob = std::vector<byte>{1_b, 2_b, 3_b};
+    byte_buffer buf;
+    binary_serializer sink{nullptr, buf};
+    CAF_CHECK(sink.apply(blob));
+    binary_deserializer source{nullptr, buf};
+    span<const byte> xs;
+    CAF_CHECK(source.read_view(xs));
+    CHECK_EQ(std::vector<byte>(xs.begin(), xs.end()), blob);
+    CHECK_EQ(xs.data(), buf.data() + 1);
+    CHECK_EQ(source.remaining(), 0u);
+  }
+  SUBTEST("truncated input") {
+    auto buf = byte_buffer({5_b, 'a'_b, 'b'_b});
+    binary_deserializer source{nullptr, buf};
+    string_view x;
+    CAF_CHECK(!source.read_view(x));
+    CHECK_EQ(source.get_error(), sec::end_of_stream);
+  }
 }
 
 CAF_TEST(binary serializer picks up inspect functions) {
@@ -9,7 +9,9 @@
 #include "core-test.hpp"
 #include "nasty.hpp"
 
+#include <array>
 #include <cstring>
+#include <limits>
 #include <vector>
 
 #include "caf/actor_system.hpp"
@@ -149,6 +151,60 @@ CAF_TEST(container types) {
     CHECK_SAVE(std::set<int8_t>, std::set<int8_t>({1, 2, 4, 8}), //
                4_b, 1_b, 2_b, 4_b, 8_b);
   }
+  SUBTEST("STL arrays") {
+    using i16_array = std::array<int16_t, 3>;
+    CHECK_SAVE(i16_array, i16_array({{1, -2, 4}}), //
+               0_b, 1_b, 0xFF_b, 0xFE_b, 0_b, 4_b);
+  }
+}
+
+CAF_TEST(arithmetic sequences produce the same output as individual values) {
+  // Runs the generic implementation that serializes each element on its own.
+  auto save_each = [](const auto& xs) {
+    byte_buffer result;
+    binary_serializer sink{nullptr, result};
+    if (!static_cast<binary_serializer::super&>(sink).list(xs))
+      CAF_FAIL("binary_serializer failed to save: " << sink.get_error());
+    return result;
+  };
+  SUBTEST("integers") {
+    auto xs = std::vector<int32_t>{0, 1, -1, 0x12345678,
+                                   std::numeric_limits<int32_t>::min()};
+    CAF_CHECK_EQUAL(save(xs), save_each(xs));
+    auto ys = std::vector<uint64_t>{0, 1, 0x0102030405060708,
+                                    std::numeric_limits<uint64_t>::max()};
+    CAF_CHECK_EQUAL(save(ys), save_each(ys));
+  }
+  SUBTEST("floating points") {
+    using flimits = std::numeric_limits<float>;
+    auto xs = std::vector<float>{0.f,
+                                 -0.f,
+                                 3.45f,
+                                 flimits::max(),
+                                 flimits::infinity(),
+                                 -flimits::infinity(),
+                                 flimits::quiet_NaN(),
+                                 flimits::denorm_min()};
+    CAF_CHECK_EQUAL(save(xs), save_each(xs));
+    using dlimits = std::numeric_limits<double>;
+    auto ys = std::vector<double>{0.,
+                                  -0.,
+                                  -2.25e300,
+                                  dlimits::min(),
+                                  dlimits::infinity(),
+                                  -dlimits::infinity(),
+                                  dlimits::quiet_NaN(),
+                                  dlimits::denorm_min()};
+    CAF_CHECK_EQUAL(save(ys), save_each(ys));
+  }
+  SUBTEST("overwriting existing data") {
+    byte_buffer data(3, 0xFF_b);
+    binary_serializer sink{nullptr, data};
+    sink.seek(1);
+    if (!sink.apply(std::vector<int16_t>{1, 2}))
+      CAF_FAIL("binary_serializer failed to save: " << sink.get_error());
+    CAF_CHECK_EQUAL(data, byte_buffer({0xFF_b, 2_b, 0_b, 1_b, 0_b, 2_b}));
+  }
 }
 
 CAF_TEST(binary serializer picks up inspect functions) {
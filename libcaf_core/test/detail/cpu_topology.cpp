@@ -0,0 +1,47 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/master/LICENSE.
+
+#define CAF_SUITE detail.cpu_topology
+
+#include "caf/detail/cpu_topology.hpp"
+
+#include "core-test.hpp"
+
+#include <algorithm>
+#include <tuple>
+
+using namespace caf;
+
+using ivec = std::vector<int>;
+
+using detail::parse_cpu_list;
+
+CAF_TEST(CPU lists contain single IDs and ranges) {
+  CHECK_EQ(parse_cpu_list("0"), ivec({0}));
+  CHECK_EQ(parse_cpu_list("0-3"), ivec({0, 1, 2, 3}));
+  CHECK_EQ(parse_cpu_list("0-1,4,6-7\n"), ivec({0, 1, 4, 6, 7}));
+  CHECK_EQ(parse_cpu_list("8,2-3,2"), ivec({2, 3, 8}));
+}
+
+CAF_TEST(parsing invalid CPU lists returns an empty list) {
+  CHECK_EQ(parse_cpu_list(""), ivec{});
+  CHECK_EQ(parse_cpu_list("a"), ivec{});
+  CHECK_EQ(parse_cpu_list("3-1"), ivec{});
+  CHECK_EQ(parse_cpu_list("1,,2"), ivec{});
+  CHECK_EQ(parse_cpu_list("-1"), ivec{});
+}
+
+CAF_TEST(the CPU topology is sorted by locality) {
+  auto cpus = detail::cpu_topology();
+  auto key = [](const detail::cpu_info& x) {
+    return std::make_tuple(x.node, x.cache_group, x.id);
+  };
+  CHECK(std::is_sorted(cpus.begin(), cpus.end(),
+                       [&](const detail::cpu_info& x,
+                           const detail::cpu_info& y) {
+                         return key(x) < key(y);
+                       }));
+  for (auto& cpu : cpus)
+    CHECK_LE(cpu.cache_group, cpu.id);
+}
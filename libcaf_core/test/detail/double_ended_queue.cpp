@@ -0,0 +1,85 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/master/LICENSE.
+
+#define CAF_SUITE detail.double_ended_queue
+
+#include "caf/detail/double_ended_queue.hpp"
+
+#include "core-test.hpp"
+
+#include <array>
+#include <vector>
+
+using namespace caf;
+
+namespace {
+
+using int_queue = detail::double_ended_queue<int>;
+
+struct fixture {
+  fixture() {
+    for (size_t i = 0; i < values.size(); ++i)
+      values[i] = static_cast<int>(i);
+  }
+
+  void fill(int_queue& q, int first, int last) {
+    for (auto i = first; i != last; ++i)
+      q.append(&values[static_cast<size_t>(i)]);
+  }
+
+  std::vector<int> drain(int_queue& q) {
+    std::vector<int> result;
+    while (auto ptr = q.take_head())
+      result.push_back(*ptr);
+    return result;
+  }
+
+  int_queue victim;
+  int_queue thief;
+  std::array<int, 10> values;
+};
+
+using ivec = std::vector<int>;
+
+} // namespace
+
+CAF_TEST_FIXTURE_SCOPE(double_ended_queue_tests, fixture)
+
+CAF_TEST(take_head and take_tail remove elements from both ends) {
+  fill(victim, 0, 3);
+  victim.prepend(&values[9]);
+  CHECK_EQ(*victim.take_head(), 9);
+  CHECK_EQ(*victim.take_tail(), 2);
+  CHECK_EQ(drain(victim), ivec({0, 1}));
+  CHECK(victim.empty());
+  CHECK_EQ(victim.take_tail(), nullptr);
+}
+
+CAF_TEST(take_tail_half fails on empty queues) {
+  CHECK_EQ(victim.take_tail_half(thief), nullptr);
+  CHECK(thief.empty());
+}
+
+CAF_TEST(take_tail_half takes the only element) {
+  fill(victim, 0, 1);
+  CHECK_EQ(*victim.take_tail_half(thief), 0);
+  CHECK(victim.empty());
+  CHECK(thief.empty());
+}
+
+CAF_TEST(take_tail_half moves half of the elements) {
+  fill(victim, 0, 5);
+  fill(thief, 8, 9);
+  CHECK_EQ(*victim.take_tail_half(thief), 4);
+  CHECK_EQ(drain(victim), ivec({0, 1}));
+  CHECK_EQ(drain(thief), ivec({8, 2, 3}));
+  MESSAGE("both queues remain usable afterwards");
+  fill(victim, 0, 4);
+  CHECK_EQ(*victim.take_tail_half(thief), 3);
+  fill(thief, 9, 10);
+  CHECK_EQ(drain(victim), ivec({0, 1}));
+  CHECK_EQ(drain(thief), ivec({2, 9}));
+}
+
+CAF_TEST_FIXTURE_SCOPE_END()
@@ -0,0 +1,72 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/master/LICENSE.
+
+#define CAF_SUITE detail.event_count
+
+#include "caf/detail/event_count.hpp"
+
+#include "core-test.hpp"
+
+#include <atomic>
+#include <thread>
+
+using namespace caf;
+using namespace std::literals::chrono_literals;
+
+namespace {
+
+struct fixture {
+  detail::event_count uut;
+};
+
+} // namespace
+
+CAF_TEST_FIXTURE_SCOPE(event_count_tests, fixture)
+
+CAF_TEST(notifying without waiters is a no-op) {
+  CHECK(!uut.has_waiters());
+  uut.notify_one();
+  uut.notify_all();
+  CHECK(!uut.has_waiters());
+}
+
+CAF_TEST(cancel_wait withdraws a waiter) {
+  auto key = uut.prepare_wait();
+  CHECK(uut.has_waiters());
+  uut.cancel_wait();
+  CHECK(!uut.has_waiters());
+  MESSAGE("the key of a withdrawn wait still matches the epoch");
+  CHECK_EQ(uut.prepare_wait(), key);
+  uut.cancel_wait();
+}
+
+CAF_TEST(wait_for returns false on timeout) {
+  auto key = uut.prepare_wait();
+  CHECK(!uut.wait_for(key, 1ms));
+  CHECK(!uut.has_waiters());
+}
+
+CAF_TEST(wait_for returns immediately after a notification) {
+  auto key = uut.prepare_wait();
+  uut.notify_one();
+  CHECK(uut.wait_for(key, 1h));
+  CHECK(!uut.has_waiters());
+}
+
+CAF_TEST(notify_one wakes up a blocked thread) {
+  std::atomic<bool> ready{false};
+  std::atomic<bool> woken{false};
+  std::thread waiter{[&] {
+    auto key = uut.prepare_wait();
+    ready = true;
+    woken = uut.wait_for(key, 1h);
+  }};
+  while (!ready)
+    std::this_thread::yield();
+  uut.notify_one();
+  waiter.join();
+  CHECK(woken);
+}
+
+CAF_TEST_FIXTURE_SCOPE_END()
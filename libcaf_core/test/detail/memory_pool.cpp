@@ -0,0 +1,156 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/master/LICENSE.
+
+#define CAF_SUITE detail.memory_pool
+
+#include "caf/detail/memory_pool.hpp"
+
+#include "core-test.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <thread>
+
+#include "caf/mailbox_element.hpp"
+
+using namespace caf;
+
+using detail::memory_pool;
+
+namespace {
+
+struct fixture {
+  fixture() {
+    memory_pool::enable(true);
+  }
+
+  ~fixture() {
+    memory_pool::enable(false);
+  }
+};
+
+} // namespace
+
+CAF_TEST_FIXTURE_SCOPE(memory_pool_tests, fixture)
+
+CAF_TEST(blocks provide the requested number of bytes) {
+  for (size_t size : {size_t{1}, size_t{48}, size_t{100},
+                      memory_pool::max_pooled_size,
+                      memory_pool::max_pooled_size + 1, size_t{4096}}) {
+    auto ptr = memory_pool::allocate(size);
+    REQUIRE_NE(ptr, nullptr);
+    CHECK_EQ(reinterpret_cast<uintptr_t>(ptr) % memory_pool::header_size, 0u);
+    memset(ptr, 0xFF, size);
+    memory_pool::deallocate(ptr);
+  }
+}
+
+CAF_TEST(the pool recycles blocks of the same size class) {
+  // Run on a fresh thread to start with empty free lists.
+  std::thread{[] {
+    auto before = memory_pool::stats();
+    auto ptr = memory_pool::allocate(40);
+    memory_pool::deallocate(ptr);
+    CHECK_EQ(memory_pool::allocate(30), ptr);
+    memory_pool::deallocate(ptr);
+    auto after = memory_pool::stats();
+    CHECK_EQ(after.hits - before.hits, 1u);
+    CHECK_EQ(after.misses - before.misses, 1u);
+  }}.join();
+}
+
+CAF_TEST(the pool bypasses free lists for large blocks) {
+  auto before = memory_pool::stats();
+  memory_pool::deallocate(memory_pool::allocate(4096));
+  auto after = memory_pool::stats();
+  CHECK_EQ(after.hits, before.hits);
+  CHECK_EQ(after.misses, before.misses);
+}
+
+CAF_TEST(blocks return to the pool of the thread that frees them) {
+  void* ptr = nullptr;
+  std::thread{[&ptr] { ptr = memory_pool::allocate(40); }}.join();
+  memory_pool::deallocate(ptr);
+  CHECK_EQ(memory_pool::allocate(40), ptr);
+  memory_pool::deallocate(ptr);
+}
+
+CAF_TEST(blocks from a disabled pool remain valid after enabling it) {
+  std::thread{[] {
+    memory_pool::enable(false);
+    auto ptr = memory_pool::allocate(40);
+    memory_pool::enable(true);
+    auto before = memory_pool::stats();
+    memory_pool::deallocate(ptr);
+    // The block has no size class and thus bypasses the free lists.
+    memory_pool::deallocate(memory_pool::allocate(40));
+    auto after = memory_pool::stats();
+    CHECK_EQ(after.hits, before.hits);
+    CHECK_EQ(after.misses - before.misses, 1u);
+  }}.join();
+}
+
+CAF_TEST(a disabled pool neither counts nor caches blocks) {
+  memory_pool::enable(false);
+  auto before = memory_pool::stats();
+  auto ptr = memory_pool::allocate(40);
+  memory_pool::deallocate(ptr);
+  memory_pool::deallocate(memory_pool::allocate(40));
+  auto after = memory_pool::stats();
+  CHECK_EQ(after.hits, before.hits);
+  CHECK_EQ(after.misses, before.misses);
+}
+
+CAF_TEST(the pool caches at most max_cached_blocks per size class) {
+  auto limit = memory_pool::max_cached_blocks();
+  memory_pool::max_cached_blocks(1);
+  auto ptr1 = memory_pool::allocate(200);
+  auto ptr2 = memory_pool::allocate(200);
+  memory_pool::deallocate(ptr1);
+  memory_pool::deallocate(ptr2);
+  auto before = memory_pool::stats();
+  CHECK_EQ(memory_pool::allocate(200), ptr1);
+  memory_pool::deallocate(memory_pool::allocate(200));
+  memory_pool::deallocate(ptr1);
+  auto after = memory_pool::stats();
+  CHECK_EQ(after.hits - before.hits, 1u);
+  CHECK_EQ(after.misses - before.misses, 1u);
+  memory_pool::max_cached_blocks(limit);
+}
+
+CAF_TEST(pairs return to the pool after releasing both objects) {
+  for (auto first_released : {true, false}) {
+    void* second = nullptr;
+    auto first = memory_pool::allocate_pair(64, 32, second);
+    REQUIRE_NE(first, nullptr);
+    CHECK_EQ(static_cast<char*>(second) - static_cast<char*>(first),
+             static_cast<ptrdiff_t>(memory_pool::pair_offset(64)));
+    memset(first, 0xFF, 64);
+    memset(second, 0xFF, 32);
+    auto size = memory_pool::pair_offset(64) + 32;
+    memory_pool::deallocate(first_released ? first : second);
+    auto other = memory_pool::allocate(size);
+    CHECK_NE(other, first);
+    memory_pool::deallocate(other);
+    memory_pool::deallocate(first_released ? second : first);
+    CHECK_EQ(memory_pool::allocate(size), first);
+    memory_pool::deallocate(first);
+  }
+}
+
+CAF_TEST(mailbox elements and messages allocate from the pool) {
+  // Warm up the free lists.
+  make_mailbox_element(nullptr, make_message_id(), {}, 1, 2.0);
+  auto before = memory_pool::stats();
+  for (int i = 0; i < 10; ++i) {
+    auto ptr = make_mailbox_element(nullptr, make_message_id(), {}, i, 2.0);
+    CHECK_EQ(ptr->payload.get_as<int32_t>(0), i);
+  }
+  auto after = memory_pool::stats();
+  // Small payloads share a single block with the mailbox element.
+  CHECK_EQ(after.hits - before.hits, 10u);
+  CHECK_EQ(after.misses, before.misses);
+}
+
+CAF_TEST_FIXTURE_SCOPE_END()
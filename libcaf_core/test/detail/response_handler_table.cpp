@@ -0,0 +1,156 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/master/LICENSE.
+
+#define CAF_SUITE detail.response_handler_table
+
+#include "caf/detail/response_handler_table.hpp"
+
+#include "core-test.hpp"
+
+#include <chrono>
+
+using namespace caf;
+
+using detail::response_handler_table;
+
+namespace {
+
+message_id response_id(uint64_t x) {
+  return make_message_id(x).response_id();
+}
+
+struct fixture {
+  response_handler_table uut;
+
+  // Returns a handler that stores `x` in `result` when called with an integer.
+  behavior make_handler(int32_t x) {
+    return {
+      [this, x](int32_t) { result = x; },
+    };
+  }
+
+  // Calls `bhvr` and returns the value stored by the handler.
+  int32_t call(behavior& bhvr) {
+    result = 0;
+    auto msg = make_message(int32_t{0});
+    bhvr(msg);
+    return result;
+  }
+
+  // Calls the handler for `id` or returns 0 if no such handler exists.
+  int32_t call(message_id id) {
+    auto ptr = uut.find(id);
+    return ptr != nullptr ? call(*ptr) : 0;
+  }
+
+  int32_t result = 0;
+};
+
+} // namespace
+
+CAF_TEST_FIXTURE_SCOPE(response_handler_table_tests, fixture)
+
+CAF_TEST(the table stores one handler per response ID) {
+  CHECK(uut.empty());
+  CHECK(uut.emplace(response_id(1), make_handler(1)));
+  CHECK(uut.emplace(response_id(2), make_handler(2)));
+  CHECK(!uut.emplace(response_id(1), make_handler(3)));
+  CHECK_EQ(uut.size(), 2u);
+  CHECK_EQ(call(response_id(1)), 1);
+  CHECK_EQ(uut.find(response_id(3)), nullptr);
+  behavior bhvr;
+  CHECK(uut.take(response_id(2), bhvr));
+  CHECK_EQ(call(bhvr), 2);
+  CHECK(!uut.take(response_id(2), bhvr));
+  CHECK(uut.erase(response_id(1)));
+  CHECK(!uut.erase(response_id(1)));
+  CHECK(uut.empty());
+}
+
+CAF_TEST(consecutive request IDs occupy distinct slots) {
+  for (int32_t i = 1; i <= 1000; ++i)
+    CHECK(uut.emplace(response_id(static_cast<uint64_t>(i)), make_handler(i)));
+  CHECK_EQ(uut.size(), 1000u);
+  CHECK_EQ(uut.capacity(), 1024u);
+  CHECK_EQ(uut.overflow_size(), 0u);
+  for (int32_t i = 1; i <= 1000; i += 2) {
+    behavior bhvr;
+    REQUIRE(uut.take(response_id(static_cast<uint64_t>(i)), bhvr));
+    CHECK_EQ(call(bhvr), i);
+  }
+  for (int32_t i = 2; i <= 1000; i += 2)
+    CHECK_EQ(call(response_id(static_cast<uint64_t>(i))), i);
+  uut.clear();
+  CHECK(uut.empty());
+  CHECK_EQ(uut.capacity(), 0u);
+}
+
+CAF_TEST(collisions double the capacity) {
+  // With 16 slots, these IDs share the same slot.
+  CHECK(uut.emplace(response_id(1), make_handler(1)));
+  CHECK_EQ(uut.capacity(), response_handler_table::min_capacity);
+  CHECK(uut.emplace(response_id(17), make_handler(2)));
+  CHECK_EQ(uut.capacity(), 32u);
+  CHECK(uut.emplace(response_id(33), make_handler(3)));
+  CHECK_EQ(uut.capacity(), 64u);
+  CHECK_EQ(uut.overflow_size(), 0u);
+  CHECK(uut.erase(response_id(17)));
+  CHECK_EQ(call(response_id(1)), 1);
+  CHECK_EQ(call(response_id(33)), 3);
+  CHECK_EQ(uut.find(response_id(17)), nullptr);
+}
+
+CAF_TEST(handlers go to the overflow map instead of sparse slots) {
+  // A single request that remains pending must not blow up the table.
+  CHECK(uut.emplace(response_id(1), make_handler(1)));
+  CHECK(uut.emplace(response_id(1 + (1 << 20)), make_handler(2)));
+  CHECK_EQ(uut.capacity(), response_handler_table::max_sparseness * 2);
+  CHECK_EQ(uut.overflow_size(), 1u);
+  CHECK_EQ(call(response_id(1)), 1);
+  CHECK_EQ(call(response_id(1 + (1 << 20))), 2);
+  // Erasing the occupant of the slot leaves the overflowing handler intact.
+  CHECK(uut.erase(response_id(1)));
+  CHECK_EQ(call(response_id(1 + (1 << 20))), 2);
+  CHECK(!uut.emplace(response_id(1 + (1 << 20)), make_handler(3)));
+  behavior bhvr;
+  CHECK(uut.take(response_id(1 + (1 << 20)), bhvr));
+  CHECK_EQ(call(bhvr), 2);
+  CHECK(uut.empty());
+  CHECK_EQ(uut.overflow_size(), 0u);
+}
+
+CAF_TEST(growing moves overflowing handlers back into the slots) {
+  auto far_id = response_id(1 + (1 << 20));
+  CHECK(uut.emplace(response_id(1), make_handler(1)));
+  CHECK(uut.emplace(far_id, make_handler(2)));
+  CHECK_EQ(uut.overflow_size(), 1u);
+  CHECK(uut.erase(response_id(1)));
+  for (int32_t i = 2; i <= 32; ++i)
+    CHECK(uut.emplace(response_id(static_cast<uint64_t>(i)), make_handler(i)));
+  CHECK_EQ(uut.capacity(), 32u);
+  // ID 34 collides with ID 2 and the table grows.
+  CHECK(uut.emplace(response_id(34), make_handler(34)));
+  CHECK_EQ(uut.capacity(), 64u);
+  CHECK_EQ(uut.overflow_size(), 0u);
+  CHECK_EQ(call(far_id), 2);
+  CHECK_EQ(call(response_id(34)), 34);
+}
+
+CAF_TEST(erasing takes constant time regardless of pending requests) {
+  // An actor with many consecutive pending requests receives the responses in
+  // order. With an erase that scans the remaining entries, this loop performs
+  // billions of steps and takes far longer than the generous limit.
+  constexpr uint64_t n = 100'000;
+  behavior handler{[](int32_t) {}};
+  auto t0 = std::chrono::steady_clock::now();
+  for (uint64_t i = 1; i <= n; ++i)
+    uut.emplace(response_id(i), handler);
+  for (uint64_t i = 1; i <= n; ++i)
+    uut.erase(response_id(i));
+  auto elapsed = std::chrono::steady_clock::now() - t0;
+  CHECK(uut.empty());
+  CHECK_LT(elapsed, std::chrono::seconds(5));
+}
+
+CAF_TEST_FIXTURE_SCOPE_END()
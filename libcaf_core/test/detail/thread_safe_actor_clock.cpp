@@ -0,0 +1,152 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/master/LICENSE.
+
+#define CAF_SUITE detail.thread_safe_actor_clock
+
+#include "caf/detail/thread_safe_actor_clock.hpp"
+
+#include "core-test.hpp"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "caf/all.hpp"
+#include "caf/detail/timing_wheel_actor_clock.hpp"
+
+using namespace caf;
+
+namespace {
+
+constexpr int32_t num_producers = 4;
+
+constexpr int32_t num_events = 1000;
+
+struct fixture {
+  actor_system_config cfg;
+  actor_system sys{cfg};
+  detail::thread_safe_actor_clock clk;
+
+  // Schedules messages from several threads at once, all due immediately, and
+  // checks that the receiver sees the messages of each thread in order.
+  void run_producers() {
+    std::thread dispatcher{[this] { clk.run_dispatch_loop(); }};
+    scoped_actor self{sys};
+    auto receiver = actor_cast<strong_actor_ptr>(self);
+    std::vector<std::thread> producers;
+    for (int32_t id = 0; id < num_producers; ++id)
+      producers.emplace_back([this, id, receiver] {
+        for (int32_t i = 0; i < num_events; ++i)
+          clk.schedule_message(actor_clock::time_point{}, receiver,
+                               make_mailbox_element(nullptr, make_message_id(),
+                                                    no_stages, id, i));
+      });
+    for (auto& producer : producers)
+      producer.join();
+    std::vector<int32_t> expected(num_producers, 0);
+    int32_t i = 0;
+    self->receive_for(i, num_producers * num_events)(
+      [&](int32_t id, int32_t value) {
+        CHECK_EQ(value, expected[static_cast<size_t>(id)]++);
+      },
+      after(std::chrono::seconds(10)) >>
+        [] { CAF_FAIL("clock failed to deliver all messages"); });
+    clk.cancel_dispatch_loop();
+    dispatcher.join();
+  }
+};
+
+// Sends itself `n` delayed messages and then issues a request to a silent
+// buddy that must time out. Reports the error and whether any of its timers
+// went to the local shard of a worker.
+behavior ticker(event_based_actor* self, int32_t n, actor buddy,
+                actor listener) {
+  self->delayed_send(self, std::chrono::milliseconds(1), n);
+  return {
+    [=](int32_t remaining) {
+      if (remaining > 0) {
+        self->delayed_send(self, std::chrono::milliseconds(1), remaining - 1);
+        return;
+      }
+      self->request(buddy, std::chrono::milliseconds(5), ok_atom_v)
+        .then([](ok_atom) { CAF_FAIL("buddy responded unexpectedly"); },
+              [=](error& err) {
+                auto flag = abstract_actor::has_worker_timers_flag;
+                self->send(listener, std::move(err), self->getf(flag));
+                self->quit();
+              });
+    },
+  };
+}
+
+struct silent_buddy_state {
+  std::vector<response_promise> pending;
+};
+
+behavior silent_buddy(stateful_actor<silent_buddy_state>* self) {
+  return {
+    [self](ok_atom) {
+      // Delay the response indefinitely.
+      self->state.pending.emplace_back(self->make_response_promise());
+    },
+  };
+}
+
+} // namespace
+
+CAF_TEST_FIXTURE_SCOPE(thread_safe_actor_clock_tests, fixture)
+
+CAF_TEST(the clock thread receives events from many threads) {
+  run_producers();
+}
+
+CAF_TEST(the clock thread receives events for the timing wheel) {
+  clk.use_timing_wheel(timespan{1'000'000});
+  run_producers();
+}
+
+CAF_TEST(workers may ship timers from local shards) {
+  actor_system_config local_cfg;
+  local_cfg.set("caf.scheduler.max-threads", 2);
+  local_cfg.set("caf.scheduler.worker-timers", true);
+  actor_system local_sys{local_cfg};
+  scoped_actor self{local_sys};
+  auto buddy = local_sys.spawn(silent_buddy);
+  for (int32_t i = 0; i < 4; ++i)
+    local_sys.spawn(ticker, 50, buddy, actor{self});
+  int32_t i = 0;
+  self->receive_for(i, 4)(
+    [](const error& err, bool used_worker_timers) {
+      CHECK_EQ(err, sec::request_timeout);
+      CHECK(used_worker_timers);
+    },
+    after(std::chrono::seconds(10)) >>
+      [] { CAF_FAIL("workers failed to ship their timers"); });
+  anon_send_exit(buddy, exit_reason::user_shutdown);
+}
+
+CAF_TEST(cancellations reach the shards of other threads) {
+  auto hdl = sys.spawn([] { return behavior{[](int32_t) {}}; });
+  auto ptr = actor_cast<abstract_actor*>(hdl);
+  detail::timing_wheel_actor_clock shard;
+  clk.bind_local_shard(&shard);
+  clk.set_request_timeout(clk.now() + std::chrono::hours(1), ptr,
+                          make_message_id().response_id());
+  CHECK_EQ(shard.size(), 1u);
+  CHECK(ptr->getf(abstract_actor::has_worker_timers_flag));
+  std::thread other{[this, ptr] {
+    detail::timing_wheel_actor_clock other_shard;
+    clk.bind_local_shard(&other_shard);
+    clk.cancel_timeouts(ptr);
+    clk.bind_local_shard(nullptr);
+  }};
+  other.join();
+  CHECK_EQ(shard.size(), 1u);
+  CHECK_EQ(clk.handle_remote_cancellations(), 1u);
+  CHECK_EQ(shard.size(), 0u);
+  clk.bind_local_shard(nullptr);
+  anon_send_exit(hdl, exit_reason::user_shutdown);
+}
+
+CAF_TEST_FIXTURE_SCOPE_END()
@@ -0,0 +1,189 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/master/LICENSE.
+
+#define CAF_SUITE detail.timing_wheel_actor_clock
+
+#include "caf/detail/timing_wheel_actor_clock.hpp"
+
+#include "core-test.hpp"
+
+#include <chrono>
+#include <vector>
+
+#include "caf/all.hpp"
+
+using namespace caf;
+
+using namespace std::chrono_literals;
+
+namespace {
+
+// A timing wheel that only advances time manually.
+class manual_wheel : public detail::timing_wheel_actor_clock {
+public:
+  manual_wheel() : current_time(duration_type{1h}) {
+    // nop
+  }
+
+  time_point now() const noexcept override {
+    return current_time;
+  }
+
+  size_t advance_time(timespan x) {
+    current_time += std::chrono::duration_cast<duration_type>(x);
+    return trigger_expired_timeouts();
+  }
+
+  time_point current_time;
+};
+
+struct tid {
+  uint32_t value;
+};
+
+bool operator==(const timeout_msg& x, const tid& y) {
+  return x.timeout_id == y.value;
+}
+
+behavior testee(event_based_actor* self) {
+  self->set_error_handler([](scheduled_actor*, error&) {});
+  return {
+    [](const std::string&) {
+      // nop
+    },
+  };
+}
+
+struct fixture : test_coordinator_fixture<> {
+  manual_wheel t;
+  actor aut;
+  abstract_actor* aut_ptr;
+
+  fixture() : aut(sys.spawn(testee)) {
+    aut_ptr = actor_cast<abstract_actor*>(aut);
+    run();
+  }
+
+  message_id request_id(uint64_t x) {
+    return make_message_id(x).response_id();
+  }
+};
+
+} // namespace
+
+CAF_TEST_FIXTURE_SCOPE(timing_wheel_tests, fixture)
+
+CAF_TEST(timeouts trigger up to one tick late but never early) {
+  CHECK_EQ(t.resolution(), timespan{1ms});
+  t.set_request_timeout(t.now() + 10ms, aut_ptr, request_id(1));
+  t.set_request_timeout(t.now() + 1500us, aut_ptr, request_id(2));
+  CHECK_EQ(t.size(), 2u);
+  CHECK_EQ(t.advance_time(1ms), 0u);
+  CHECK_EQ(t.advance_time(500us), 0u);
+  CHECK_EQ(t.advance_time(500us), 1u);
+  expect((error), from(aut).to(aut).with(sec::request_timeout));
+  CHECK_EQ(t.advance_time(7ms), 0u);
+  CHECK_EQ(t.advance_time(1ms), 1u);
+  expect((error), from(aut).to(aut).with(sec::request_timeout));
+  CHECK(t.empty());
+}
+
+CAF_TEST(cancelling a request timeout removes only that timeout) {
+  for (uint64_t id = 1; id <= 3; ++id)
+    t.set_request_timeout(t.now() + 10ms, aut_ptr, request_id(id));
+  CHECK_EQ(t.size(), 3u);
+  t.cancel_request_timeout(aut_ptr, request_id(2));
+  CHECK_EQ(t.size(), 2u);
+  t.cancel_request_timeout(aut_ptr, request_id(2));
+  CHECK_EQ(t.size(), 2u);
+  CHECK_EQ(t.advance_time(10ms), 2u);
+  CHECK(t.empty());
+}
+
+CAF_TEST(ordinary timeouts override previous timeouts of the same type) {
+  t.set_ordinary_timeout(t.now() + 10ms, aut_ptr, "foo", 1);
+  t.set_ordinary_timeout(t.now() + 10ms, aut_ptr, "bar", 2);
+  t.set_ordinary_timeout(t.now() + 20ms, aut_ptr, "foo", 3);
+  CHECK_EQ(t.size(), 2u);
+  CHECK_EQ(t.advance_time(10ms), 1u);
+  expect((timeout_msg), from(aut).to(aut).with(tid{2}));
+  t.cancel_ordinary_timeout(aut_ptr, "foo");
+  CHECK(t.empty());
+  CHECK_EQ(t.advance_time(10ms), 0u);
+}
+
+CAF_TEST(cancel_timeouts drops all timeouts of an actor) {
+  auto other = sys.spawn(testee);
+  run();
+  auto other_ptr = actor_cast<abstract_actor*>(other);
+  t.set_ordinary_timeout(t.now() + 10ms, aut_ptr, "foo", 1);
+  t.set_multi_timeout(t.now() + 10ms, aut_ptr, "foo", 2);
+  t.set_request_timeout(t.now() + 10ms, aut_ptr, request_id(3));
+  t.set_request_timeout(t.now() + 10ms, other_ptr, request_id(3));
+  auto autptr = actor_cast<strong_actor_ptr>(aut);
+  t.schedule_message(t.now() + 10ms, autptr,
+                     make_mailbox_element(autptr, make_message_id(), no_stages,
+                                          "foo"));
+  CHECK_EQ(t.size(), 5u);
+  t.cancel_timeouts(aut_ptr);
+  CHECK_EQ(t.size(), 2u);
+  CHECK_EQ(t.advance_time(10ms), 2u);
+  expect((error), from(other).to(other).with(sec::request_timeout));
+  expect((std::string), from(aut).to(aut).with("foo"));
+}
+
+CAF_TEST(timeouts with long delays move down the hierarchy) {
+  std::vector<timespan> delays{1s, 1min, 2h, 30h};
+  for (size_t i = 0; i < delays.size(); ++i)
+    t.set_multi_timeout(t.now() + delays[i], aut_ptr, "foo",
+                        static_cast<uint64_t>(i));
+  timespan elapsed{0};
+  for (size_t i = 0; i < delays.size(); ++i) {
+    MESSAGE("advance the clock to " << delays[i]);
+    CHECK_EQ(t.advance_time(delays[i] - elapsed - 1ms), 0u);
+    CHECK_EQ(t.advance_time(1ms), 1u);
+    expect((timeout_msg),
+           from(aut).to(aut).with(tid{static_cast<uint32_t>(i)}));
+    elapsed = delays[i];
+    CHECK_EQ(t.size(), delays.size() - i - 1);
+  }
+}
+
+CAF_TEST(next_timeout returns when the clock needs to advance next) {
+  CHECK_EQ(t.next_timeout(), none);
+  t.set_request_timeout(t.now() + 10ms, aut_ptr, request_id(1));
+  CHECK_EQ(t.next_timeout(), t.now() + 10ms);
+  t.set_request_timeout(t.now() + 5ms, aut_ptr, request_id(2));
+  CHECK_EQ(t.next_timeout(), t.now() + 5ms);
+  t.cancel_all();
+  CHECK_EQ(t.next_timeout(), none);
+}
+
+CAF_TEST(the timing wheel schedules and cancels many timers) {
+  // The benchmark caf-bench-timing-wheel-actor-clock runs the same steps with
+  // 10^6 timers and compares the timing wheel to the simple actor clock.
+  constexpr size_t num_actors = 10;
+  constexpr uint64_t num_timers = 1'000;
+  constexpr uint64_t cancel_stride = 10;
+  std::vector<actor> actors;
+  std::vector<abstract_actor*> ptrs;
+  for (size_t i = 0; i < num_actors; ++i) {
+    actors.emplace_back(sys.spawn(testee));
+    ptrs.emplace_back(actor_cast<abstract_actor*>(actors.back()));
+  }
+  run();
+  auto base = t.now() + 1s;
+  for (uint64_t i = 0; i < num_timers; ++i)
+    t.set_request_timeout(base + i * 3600ms, ptrs[i % num_actors],
+                          request_id(i));
+  CHECK_EQ(t.size(), num_timers);
+  for (uint64_t i = 0; i < num_timers; i += cancel_stride)
+    t.cancel_request_timeout(ptrs[i % num_actors], request_id(i));
+  CHECK_EQ(t.size(), num_timers - num_timers / cancel_stride);
+  for (auto ptr : ptrs)
+    t.cancel_timeouts(ptr);
+  CHECK_EQ(t.size(), 0u);
+}
+
+CAF_TEST_FIXTURE_SCOPE_END()
@@ -0,0 +1,96 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/master/LICENSE.
+
+#define CAF_SUITE detail.typed_memory_pool
+
+#include "caf/detail/typed_memory_pool.hpp"
+
+#include "core-test.hpp"
+
+#include <thread>
+
+#include "caf/actor_storage.hpp"
+#include "caf/event_based_actor.hpp"
+
+using namespace caf;
+
+using detail::memory_pool;
+using detail::typed_memory_pool;
+
+namespace {
+
+struct alignas(64) big_object {
+  char data[1000];
+};
+
+using big_object_pool = typed_memory_pool<big_object>;
+
+using storage_pool = typed_memory_pool<actor_storage<event_based_actor>>;
+
+struct fixture : test_coordinator_fixture<> {
+  fixture() {
+    memory_pool::enable(true);
+  }
+
+  ~fixture() {
+    memory_pool::enable(false);
+  }
+};
+
+} // namespace
+
+CAF_TEST_FIXTURE_SCOPE(typed_memory_pool_tests, fixture)
+
+CAF_TEST(the pool recycles blocks per type) {
+  // Run on a fresh thread to start with empty free lists.
+  std::thread{[] {
+    auto ptr = big_object_pool::allocate();
+    CHECK_EQ(reinterpret_cast<uintptr_t>(ptr) % alignof(big_object), 0u);
+    big_object_pool::deallocate(ptr);
+    CHECK_EQ(big_object_pool::cached_blocks(), 1u);
+    CHECK_EQ(big_object_pool::allocate(), ptr);
+    CHECK_EQ(big_object_pool::cached_blocks(), 0u);
+    big_object_pool::deallocate(ptr);
+  }}.join();
+}
+
+CAF_TEST(threads keep at most max_cached_blocks blocks per type) {
+  std::thread{[] {
+    auto limit = memory_pool::max_cached_blocks();
+    memory_pool::max_cached_blocks(2);
+    void* ptrs[3];
+    for (auto& ptr : ptrs)
+      ptr = big_object_pool::allocate();
+    for (auto ptr : ptrs)
+      big_object_pool::deallocate(ptr);
+    CHECK_EQ(big_object_pool::cached_blocks(), 2u);
+    memory_pool::max_cached_blocks(limit);
+  }}.join();
+}
+
+CAF_TEST(the pool bypasses the free lists while disabled) {
+  std::thread{[] {
+    memory_pool::enable(false);
+    big_object_pool::deallocate(big_object_pool::allocate());
+    CHECK_EQ(big_object_pool::cached_blocks(), 0u);
+    memory_pool::enable(true);
+  }}.join();
+}
+
+CAF_TEST(spawning reuses the storage of terminated actors) {
+  auto spawn_and_release = [this] {
+    auto hdl = sys.spawn([] { return behavior{[](int32_t) {}}; });
+    auto addr = static_cast<void*>(actor_cast<actor_control_block*>(hdl));
+    anon_send_exit(hdl, exit_reason::user_shutdown);
+    run();
+    hdl = nullptr;
+    return addr;
+  };
+  auto before = storage_pool::cached_blocks();
+  auto first = spawn_and_release();
+  CHECK_EQ(storage_pool::cached_blocks(), before + 1);
+  CHECK_EQ(spawn_and_release(), first);
+}
+
+CAF_TEST_FIXTURE_SCOPE_END()
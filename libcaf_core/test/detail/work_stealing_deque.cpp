@@ -0,0 +1,111 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/master/LICENSE.
+
+#define CAF_SUITE detail.work_stealing_deque
+
+#include "caf/detail/work_stealing_deque.hpp"
+
+#include "core-test.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace caf;
+
+namespace {
+
+using int_deque = detail::work_stealing_deque<int>;
+
+struct fixture {
+  fixture() : uut(4) {
+    for (size_t i = 0; i < values.size(); ++i)
+      values[i] = static_cast<int>(i);
+  }
+
+  int_deque uut;
+  std::array<int, 1000> values;
+};
+
+} // namespace
+
+CAF_TEST_FIXTURE_SCOPE(work_stealing_deque_tests, fixture)
+
+CAF_TEST(a default constructed deque is empty) {
+  CHECK(uut.empty());
+  CHECK_EQ(uut.size(), 0u);
+  CHECK_EQ(uut.pop_bottom(), nullptr);
+  CHECK_EQ(uut.steal(), nullptr);
+}
+
+CAF_TEST(the owner pops elements in LIFO order) {
+  for (int i = 0; i < 3; ++i)
+    uut.push_bottom(&values[i]);
+  CHECK_EQ(uut.size(), 3u);
+  CHECK_EQ(uut.pop_bottom(), &values[2]);
+  CHECK_EQ(uut.pop_bottom(), &values[1]);
+  CHECK_EQ(uut.pop_bottom(), &values[0]);
+  CHECK_EQ(uut.pop_bottom(), nullptr);
+  CHECK(uut.empty());
+}
+
+CAF_TEST(thieves steal elements in FIFO order) {
+  for (int i = 0; i < 3; ++i)
+    uut.push_bottom(&values[i]);
+  CHECK_EQ(uut.steal(), &values[0]);
+  CHECK_EQ(uut.steal(), &values[1]);
+  CHECK_EQ(uut.pop_bottom(), &values[2]);
+  CHECK_EQ(uut.steal(), nullptr);
+  CHECK(uut.empty());
+}
+
+CAF_TEST(the deque grows when running full) {
+  CHECK_EQ(uut.capacity(), 4u);
+  for (int i = 0; i < 10; ++i)
+    uut.push_bottom(&values[i]);
+  CHECK_EQ(uut.capacity(), 16u);
+  CHECK_EQ(uut.size(), 10u);
+  CHECK_EQ(uut.steal(), &values[0]);
+  for (int i = 9; i > 0; --i)
+    CHECK_EQ(uut.pop_bottom(), &values[i]);
+  CHECK(uut.empty());
+}
+
+CAF_TEST(concurrent thieves receive each element exactly once) {
+  std::atomic<bool> done{false};
+  auto thief = [&](std::vector<int>* result) {
+    for (;;) {
+      if (auto ptr = uut.steal())
+        result->push_back(*ptr);
+      else if (done)
+        return;
+    }
+  };
+  std::vector<std::vector<int>> stolen(3);
+  std::vector<std::thread> thieves;
+  for (auto& vec : stolen)
+    thieves.emplace_back(thief, &vec);
+  std::vector<int> popped;
+  for (auto& x : values) {
+    uut.push_bottom(&x);
+    if (x % 3 == 0)
+      if (auto ptr = uut.pop_bottom())
+        popped.push_back(*ptr);
+  }
+  while (auto ptr = uut.pop_bottom())
+    popped.push_back(*ptr);
+  done = true;
+  for (auto& t : thieves)
+    t.join();
+  for (auto& vec : stolen)
+    popped.insert(popped.end(), vec.begin(), vec.end());
+  std::sort(popped.begin(), popped.end());
+  CHECK_EQ(popped.size(), values.size());
+  CHECK(std::equal(popped.begin(), popped.end(), values.begin(),
+                   values.end()));
+}
+
+CAF_TEST_FIXTURE_SCOPE_END()
@@ -114,6 +114,39 @@ CAF_TEST(unblock) {
   CAF_REQUIRE_EQUAL(close_and_fetch(), "01");
 }
 
+CAF_TEST(push_back_chain) {
+  fill(inbox, 1);
+  auto first = new inode(2);
+  first->next = new inode(3);
+  first->next->next = new inode(4);
+  CAF_REQUIRE_EQUAL(inbox.push_back_chain(first), inbox_result::success);
+  fill(inbox, 5);
+  CAF_REQUIRE_EQUAL(close_and_fetch(), "12345");
+}
+
+CAF_TEST(push_back_chain_unblocks_reader_once) {
+  CAF_REQUIRE_EQUAL(inbox.try_block(), true);
+  auto first = new inode(1);
+  first->next = new inode(2);
+  CAF_REQUIRE_EQUAL(inbox.push_back_chain(first),
+                    inbox_result::unblocked_reader);
+  first = new inode(3);
+  first->next = new inode(4);
+  CAF_REQUIRE_EQUAL(inbox.push_back_chain(first), inbox_result::success);
+  CAF_REQUIRE_EQUAL(close_and_fetch(), "1234");
+}
+
+CAF_TEST(push_back_chain_after_close) {
+  inbox.close();
+  std::unique_ptr<inode> first{new inode(1)};
+  std::unique_ptr<inode> second{new inode(2)};
+  first->next = second.get();
+  auto res = inbox.push_back_chain(first.get());
+  CAF_REQUIRE_EQUAL(res, inbox_result::queue_closed);
+  CAF_CHECK_EQUAL(first->next, second.get());
+  CAF_CHECK_EQUAL(second->next, nullptr);
+}
+
 CAF_TEST(await) {
   std::mutex mx;
   std::condition_variable cv;
@@ -8,7 +8,10 @@
 
 #include "caf/test/unit_test.hpp"
 
+#include <cstddef>
 #include <memory>
+#include <thread>
+#include <vector>
 
 #include "caf/intrusive/singly_linked.hpp"
 
@@ -78,8 +81,42 @@ struct fixture {
   }
 };
 
+// Mimics an actor that updates its own state right next to its mailbox while
+// processing messages.
+struct actor_like {
+  inbox_type inbox;
+  std::atomic<size_t> owner_state{0};
+};
+
+static_assert(sizeof(inbox_type) == CAF_CACHE_LINE_SIZE,
+              "the stack head must occupy a cache line of its own");
+
+static_assert(offsetof(actor_like, owner_state) == CAF_CACHE_LINE_SIZE,
+              "members after the inbox must start on a new cache line");
+
 } // namespace
 
+CAF_TEST(multiple producers enqueue concurrently) {
+  constexpr size_t num_producers = 4;
+  constexpr size_t num_items = 100;
+  actor_like self;
+  std::vector<std::thread> producers;
+  for (size_t i = 0; i < num_producers; ++i)
+    producers.emplace_back([&self] {
+      for (size_t j = 0; j < num_items; ++j)
+        self.inbox.emplace_front(static_cast<int>(j));
+    });
+  for (auto& t : producers)
+    t.join();
+  inode_policy::unique_pointer ptr{self.inbox.take_head()};
+  while (ptr != nullptr) {
+    auto next = ptr->next;
+    self.owner_state.fetch_add(1, std::memory_order_relaxed);
+    ptr.reset(inbox_type::promote(next));
+  }
+  CAF_CHECK_EQUAL(self.owner_state.load(), num_producers * num_items);
+}
+
 CAF_TEST_FIXTURE_SCOPE(lifo_inbox_tests, fixture)
 
 CAF_TEST(default_constructed) {
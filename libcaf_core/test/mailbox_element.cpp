@@ -20,6 +20,7 @@ using std::tuple;
 using std::vector;
 
 using namespace caf;
+using namespace std::literals;
 
 namespace {
 
@@ -65,6 +66,16 @@ CAF_TEST(tuple) {
   CAF_CHECK_EQUAL((fetch<int, int, int>(*m1)), make_tuple(1, 2, 3));
 }
 
+CAF_TEST(inline payloads outlive their mailbox element) {
+  auto m1 = make_mailbox_element(nullptr, make_message_id(), no_stages, 1,
+                                 string{"hello world"});
+  auto msg = m1->content();
+  m1.reset();
+  CAF_CHECK_EQUAL((fetch<int, string>(msg)), make_tuple(1, "hello world"s));
+  msg.get_mutable_as<int>(0) = 2;
+  CAF_CHECK_EQUAL((fetch<int, string>(msg)), make_tuple(2, "hello world"s));
+}
+
 CAF_TEST(high_priority) {
   auto m1 = make_mailbox_element(nullptr,
                                  make_message_id(message_priority::high),
@@ -166,6 +166,54 @@ CAF_TEST(requesters support fan_out_request) {
   CAF_CHECK_EQUAL(*sum, 9);
 }
 
+CAF_TEST(fan_out_request uses a single timeout for all requests) {
+  using policy::select_all;
+  std::vector<adding_server_type> workers{
+    make_server([](int x, int y) { return x + y; }),
+    make_server([](int x, int y) { return x + y; }),
+    make_server([](int x, int y) { return x + y; }),
+  };
+  run();
+  auto sum = std::make_shared<int>(0);
+  auto client = sys.spawn([=](event_based_actor* self) {
+    self->fan_out_request<select_all>(workers, std::chrono::seconds(1), 1, 2)
+      .then(
+        [=](std::vector<int> results) {
+          *sum = std::accumulate(results.begin(), results.end(), 0);
+        },
+        ERROR_HANDLER);
+  });
+  run_once();
+  CAF_CHECK_EQUAL(sched.clock().schedule().size(), 1u);
+  run();
+  CAF_CHECK_EQUAL(*sum, 9);
+  CAF_MESSAGE("the client cancels the timeout after receiving all responses");
+  CAF_CHECK(sched.clock().schedule().empty());
+}
+
+CAF_TEST(fan_out_request times out all pending requests at once) {
+  using policy::select_all;
+  std::vector<adding_server_type> workers{
+    make_server([](int x, int y) { return x + y; }),
+    make_server([](int x, int y) { return x + y; }),
+  };
+  run();
+  auto err = std::make_shared<error>();
+  auto client = sys.spawn([=](event_based_actor* self) {
+    self->fan_out_request<select_all>(workers, std::chrono::seconds(1), 1, 2)
+      .then([](std::vector<int>) { CAF_FAIL("unexpected results"); },
+            [=](error& x) { *err = std::move(x); });
+  });
+  run_once();
+  CAF_REQUIRE(sched.clock().trigger_timeout());
+  sched.prioritize(client);
+  sched.run_once();
+  CAF_CHECK_EQUAL(*err, sec::request_timeout);
+  CAF_MESSAGE("the client drops responses that arrive after the timeout");
+  run();
+  CAF_CHECK_EQUAL(*err, sec::request_timeout);
+}
+
 #ifdef CAF_ENABLE_EXCEPTIONS
 
 CAF_TEST(exceptions while processing requests trigger error messages) {
@@ -0,0 +1,109 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/master/LICENSE.
+
+#define CAF_SUITE policy.lock_free_work_stealing
+
+#include "caf/policy/lock_free_work_stealing.hpp"
+
+#include "core-test.hpp"
+
+#include <vector>
+
+#include "caf/actor_system.hpp"
+#include "caf/actor_system_config.hpp"
+#include "caf/event_based_actor.hpp"
+#include "caf/scoped_actor.hpp"
+#include "caf/stateful_actor.hpp"
+
+using namespace caf;
+
+namespace {
+
+behavior adder() {
+  return {
+    [](int32_t x, int32_t y) { return x + y; },
+  };
+}
+
+struct ring_state {
+  actor next;
+};
+
+// Forwards a token with a hop count to the next member of the ring until the
+// count reaches 0, then reports to the sink.
+behavior ring_member(stateful_actor<ring_state>* self) {
+  return {
+    [self](const actor& next) { self->state.next = next; },
+    [self](int32_t hops, const actor& sink) {
+      if (hops == 0)
+        self->send(sink, ok_atom_v);
+      else
+        self->send(self->state.next, hops - 1, sink);
+    },
+  };
+}
+
+struct fixture {
+  fixture() {
+    cfg.set("caf.scheduler.policy", "lock-free-stealing");
+    cfg.set("caf.scheduler.max-threads", 4);
+  }
+
+  void run_ring(actor_system& sys, size_t ring_size, int32_t hops) {
+    scoped_actor self{sys};
+    std::vector<actor> ring;
+    for (size_t i = 0; i < ring_size; ++i)
+      ring.emplace_back(sys.spawn(ring_member));
+    for (size_t i = 0; i < ring_size; ++i)
+      self->send(ring[i], ring[(i + 1) % ring_size]);
+    // Start one token per member to keep all workers busy.
+    for (auto& member : ring)
+      self->send(member, hops, actor{self});
+    size_t received = 0;
+    self->receive_for(received, ring_size)(
+      [](ok_atom) {
+        // nop
+      },
+      after(std::chrono::seconds(30)) >>
+        [] { CAF_FAIL("tokens did not reach their final hop in time"); });
+    for (auto& member : ring)
+      self->send_exit(member, exit_reason::user_shutdown);
+  }
+
+  actor_system_config cfg;
+};
+
+} // namespace
+
+CAF_TEST_FIXTURE_SCOPE(lock_free_work_stealing_tests, fixture)
+
+CAF_TEST(actors run on a scheduler with the lock-free stealing policy) {
+  actor_system sys{cfg};
+  CHECK_EQ(sys.scheduler().num_workers(), 4u);
+  scoped_actor self{sys};
+  std::vector<actor> workers;
+  for (int32_t i = 0; i < 100; ++i)
+    workers.emplace_back(sys.spawn(adder));
+  int32_t sum = 0;
+  for (int32_t i = 0; i < 100; ++i)
+    self->request(workers[static_cast<size_t>(i)], infinite, i, 1)
+      .receive([&sum](int32_t x) { sum += x; },
+               [](const error& err) { CAF_FAIL("request failed: " << err); });
+  CHECK_EQ(sum, 5050);
+  for (auto& worker : workers)
+    self->send_exit(worker, exit_reason::user_shutdown);
+}
+
+CAF_TEST(workers pass messages between actors via their local deques) {
+  actor_system sys{cfg};
+  run_ring(sys, 64, 1000);
+}
+
+CAF_TEST(batch stealing distributes work from the local deques) {
+  cfg.set("caf.work-stealing.batch-steal", true);
+  actor_system sys{cfg};
+  run_ring(sys, 64, 1000);
+}
+
+CAF_TEST_FIXTURE_SCOPE_END()
@@ -8,6 +8,12 @@
 
 #include "caf/test/dsl.hpp"
 
+#include <vector>
+
+#if defined(__GLIBC__)
+#  include <malloc.h>
+#endif
+
 using namespace caf;
 
 #define ASSERT_COMPILES(expr, msg)                                             \
@@ -141,3 +147,284 @@ ASSERT_COMPILES(set_exception_handler(const_exception_fn{}),
 #endif // CAF_ENABLE_EXCEPTIONS
 
 } // namespace
+
+namespace {
+
+// Links the mailbox elements for `xs...` in FIFO order.
+template <class... Ts>
+mailbox_element_ptr make_chain(Ts... xs) {
+  mailbox_element_ptr elements[] = {
+    make_mailbox_element(nullptr, make_message_id(), no_stages, xs)...};
+  for (size_t i = sizeof...(Ts) - 1; i > 0; --i)
+    elements[i - 1]->next = elements[i].release();
+  return std::move(elements[0]);
+}
+
+} // namespace
+
+CAF_TEST_FIXTURE_SCOPE(enqueue_batch_tests, test_coordinator_fixture<>)
+
+CAF_TEST(enqueue_batch appends all elements and schedules the actor once) {
+  auto received = std::make_shared<std::vector<int32_t>>();
+  auto aut = sys.spawn([received](event_based_actor*) -> behavior {
+    return {
+      [received](int32_t x) { received->emplace_back(x); },
+    };
+  });
+  run();
+  actor_cast<strong_actor_ptr>(aut)->enqueue_batch(make_chain(1, 2, 3),
+                                                   nullptr);
+  CAF_CHECK_EQUAL(sched.jobs.size(), 1u);
+  run();
+  CAF_CHECK_EQUAL(*received, std::vector<int32_t>({1, 2, 3}));
+}
+
+CAF_TEST(enqueue_batch bounces requests to terminated actors) {
+  auto client = sys.spawn([](event_based_actor*) -> behavior {
+    return {
+      [](int32_t) {},
+    };
+  });
+  auto aut = sys.spawn([](event_based_actor* self) { self->quit(); });
+  run();
+  auto chain = make_chain(1, 2);
+  chain->sender = actor_cast<strong_actor_ptr>(client);
+  chain->mid = make_message_id(42);
+  actor_cast<strong_actor_ptr>(aut)->enqueue_batch(std::move(chain), nullptr);
+  expect((error), to(client).with(sec::request_receiver_down));
+  disallow((error), to(client));
+}
+
+CAF_TEST_FIXTURE_SCOPE_END()
+
+namespace {
+
+using int_list = std::vector<int32_t>;
+
+class collector : public event_based_actor {
+public:
+  collector(actor_config& cfg, std::shared_ptr<int_list> received)
+    : event_based_actor(cfg), received_(std::move(received)) {
+    // nop
+  }
+
+  behavior make_behavior() override {
+    return {
+      [this](int32_t x) { received_->emplace_back(x); },
+    };
+  }
+
+private:
+  std::shared_ptr<int_list> received_;
+};
+
+struct bounded_fixture : test_coordinator_fixture<> {
+  std::shared_ptr<int_list> received = std::make_shared<int_list>();
+
+  actor spawn_bounded(size_t capacity, mailbox_overflow_policy policy) {
+    actor_config cfg;
+    cfg.bound_mailbox(capacity, policy);
+    auto result = sys.spawn_class<collector, no_spawn_options>(cfg, received);
+    run();
+    return result;
+  }
+};
+
+} // namespace
+
+CAF_TEST_FIXTURE_SCOPE(bounded_mailbox_tests, bounded_fixture)
+
+CAF_TEST(drop_newest discards messages that arrive at a full mailbox) {
+  auto aut = spawn_bounded(2, mailbox_overflow_policy::drop_newest);
+  for (int32_t x = 1; x <= 4; ++x)
+    anon_send(aut, x);
+  CAF_CHECK(actor_cast<abstract_actor*>(aut)->mailbox_congested());
+  run();
+  CAF_CHECK_EQUAL(*received, int_list({1, 2}));
+  CAF_CHECK(!actor_cast<abstract_actor*>(aut)->mailbox_congested());
+  anon_send(aut, 5);
+  run();
+  CAF_CHECK_EQUAL(*received, int_list({1, 2, 5}));
+}
+
+CAF_TEST(drop_oldest discards the oldest messages before processing) {
+  auto aut = spawn_bounded(2, mailbox_overflow_policy::drop_oldest);
+  for (int32_t x = 1; x <= 4; ++x)
+    anon_send(aut, x);
+  run();
+  CAF_CHECK_EQUAL(*received, int_list({3, 4}));
+  CAF_CHECK(!actor_cast<abstract_actor*>(aut)->mailbox_congested());
+}
+
+CAF_TEST(reject sends mailbox_full to the sender) {
+  auto aut = spawn_bounded(1, mailbox_overflow_policy::reject);
+  self->send(aut, 1);
+  self->send(aut, 2);
+  self->receive([](error& err) { CAF_CHECK_EQUAL(err, sec::mailbox_full); });
+  run();
+  CAF_CHECK_EQUAL(*received, int_list({1}));
+}
+
+CAF_TEST(full mailboxes respond to requests with mailbox_full) {
+  auto aut = spawn_bounded(1, mailbox_overflow_policy::drop_newest);
+  anon_send(aut, 1);
+  self->request(aut, infinite, 2)
+    .receive([] { CAF_FAIL("expected an error"); },
+             [](error& err) { CAF_CHECK_EQUAL(err, sec::mailbox_full); });
+  run();
+  CAF_CHECK_EQUAL(*received, int_list({1}));
+}
+
+CAF_TEST(backoff accepts all messages but signals congestion) {
+  auto aut = spawn_bounded(2, mailbox_overflow_policy::backoff);
+  auto ptr = actor_cast<abstract_actor*>(aut);
+  anon_send(aut, 1);
+  CAF_CHECK(!ptr->mailbox_congested());
+  anon_send(aut, 2);
+  anon_send(aut, 3);
+  CAF_CHECK(ptr->mailbox_congested());
+  run();
+  CAF_CHECK_EQUAL(*received, int_list({1, 2, 3}));
+  CAF_CHECK(!ptr->mailbox_congested());
+}
+
+CAF_TEST(system messages bypass the mailbox capacity) {
+  auto aut = spawn_bounded(1, mailbox_overflow_policy::drop_newest);
+  anon_send(aut, 1);
+  anon_send_exit(aut, exit_reason::user_shutdown);
+  run();
+  CAF_CHECK_EQUAL(*received, int_list({1}));
+  CAF_CHECK(!actor_cast<abstract_actor*>(aut)->mailbox_congested());
+  CAF_MESSAGE("the actor terminated and no longer receives messages");
+  anon_send(aut, 2);
+  run();
+  CAF_CHECK_EQUAL(*received, int_list({1}));
+}
+
+CAF_TEST(urgent user messages count towards the mailbox capacity) {
+  auto aut = spawn_bounded(1, mailbox_overflow_policy::drop_newest);
+  anon_send(aut, 1);
+  anon_send<message_priority::high>(aut, 2);
+  run();
+  CAF_CHECK_EQUAL(*received, int_list({1}));
+}
+
+CAF_TEST(user messages with system message types count towards the capacity) {
+  auto aut = spawn_bounded(1, mailbox_overflow_policy::drop_newest);
+  anon_send(aut, 1);
+  CAF_MESSAGE("the actor drops the error instead of terminating");
+  self->send(aut, make_error(sec::runtime_error));
+  CAF_MESSAGE("the actor drops the exit message of an unrelated sender");
+  self->send(aut, exit_msg{actor_addr{}, exit_reason::user_shutdown});
+  run();
+  anon_send(aut, 2);
+  run();
+  CAF_CHECK_EQUAL(*received, int_list({1, 2}));
+}
+
+CAF_TEST_FIXTURE_SCOPE_END()
+
+namespace {
+
+behavior idle_actor() {
+  return {
+    [](int32_t) {
+      // nop
+    },
+  };
+}
+
+} // namespace
+
+CAF_TEST_FIXTURE_SCOPE(footprint_tests, test_coordinator_fixture<>)
+
+CAF_TEST(idle actors do not allocate their cold state) {
+  auto aut = sys.spawn(idle_actor);
+  run();
+  inject((int32_t), from(self).to(aut).with(42));
+  CAF_CHECK(!deref<scheduled_actor>(aut).has_cold_state());
+}
+
+CAF_TEST(setting a custom handler allocates the cold state) {
+  auto aut = sys.spawn([](event_based_actor* self) {
+    self->set_down_handler([](down_msg&) {
+      // nop
+    });
+    return idle_actor();
+  });
+  run();
+  CAF_CHECK(deref<scheduled_actor>(aut).has_cold_state());
+}
+
+// The numbers below reflect 64-bit builds with libstdc++. Other standard
+// libraries use different sizes for the containers of the actor.
+#if defined(__x86_64__) && defined(__GLIBCXX__)
+
+CAF_TEST(idle actors stay within their memory budget) {
+  CAF_CHECK_LESS_OR_EQUAL(sizeof(event_based_actor), 1152u);
+#  if defined(__GLIBC__)
+#    if __GLIBC_PREREQ(2, 33)
+  constexpr size_t num_actors = 100;
+  std::vector<actor> actors;
+  actors.reserve(num_actors);
+  auto before = mallinfo2().uordblks;
+  for (size_t i = 0; i < num_actors; ++i)
+    actors.emplace_back(sys.spawn(idle_actor));
+  run();
+  auto heap_bytes = (mallinfo2().uordblks - before) / num_actors;
+  CAF_MESSAGE("idle actors allocate " << heap_bytes << " bytes on the heap");
+  CAF_CHECK_LESS_OR_EQUAL(heap_bytes, 1408u);
+#    endif
+#  endif
+}
+
+#endif
+
+CAF_TEST_FIXTURE_SCOPE_END()
+
+namespace {
+
+struct time_budget_config : actor_system_config {
+  time_budget_config() {
+    set("caf.scheduler.max-throughput-time", timespan{10'000'000});
+  }
+};
+
+} // namespace
+
+CAF_TEST_FIXTURE_SCOPE(time_budget_tests,
+                       test_coordinator_fixture<time_budget_config>)
+
+CAF_TEST(actors derive their message quota from the time budget) {
+  size_t processed = 0;
+  auto aut = sys.spawn([this, &processed](event_based_actor*) -> behavior {
+    return {
+      [this, &processed](int32_t) {
+        // Each message takes 1ms.
+        sched.clock().current_time += std::chrono::milliseconds(1);
+        ++processed;
+      },
+    };
+  });
+  run();
+  for (int32_t i = 0; i < 50; ++i)
+    self->send(aut, i);
+  auto& ref = deref<scheduled_actor>(aut);
+  auto ctx = sys.dummy_execution_unit();
+  CAF_MESSAGE("without samples, actors stop after exhausting their budget");
+  CAF_CHECK_EQUAL(ref.resume(ctx, 100), resumable::resume_later);
+  CAF_CHECK_EQUAL(processed, 12u);
+  CAF_MESSAGE("with samples, actors consume what fits into their budget");
+  processed = 0;
+  CAF_CHECK_EQUAL(ref.resume(ctx, 100), resumable::resume_later);
+  CAF_CHECK_EQUAL(processed, 10u);
+  CAF_MESSAGE("the maximum throughput still limits the number of messages");
+  processed = 0;
+  CAF_CHECK_EQUAL(ref.resume(ctx, 5), resumable::resume_later);
+  CAF_CHECK_EQUAL(processed, 5u);
+  processed = 0;
+  run();
+  CAF_CHECK_EQUAL(processed, 23u);
+}
+
+CAF_TEST_FIXTURE_SCOPE_END()
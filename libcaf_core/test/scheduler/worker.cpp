@@ -0,0 +1,103 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/master/LICENSE.
+
+#define CAF_SUITE scheduler.worker
+
+#include "caf/scheduler/worker.hpp"
+
+#include "core-test.hpp"
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "caf/actor_system.hpp"
+#include "caf/actor_system_config.hpp"
+#include "caf/event_based_actor.hpp"
+#include "caf/scoped_actor.hpp"
+
+using namespace caf;
+
+namespace {
+
+// Records the order in which actors process their messages.
+struct run_log {
+  std::mutex mtx;
+  std::vector<std::string> entries;
+
+  void add(const std::string& name) {
+    std::unique_lock<std::mutex> guard{mtx};
+    entries.emplace_back(name);
+  }
+};
+
+// Logs `name` and then sends a message to each of the `targets` in order.
+behavior recorder(event_based_actor* self, std::string name, run_log* log,
+                  std::vector<actor> targets, actor sink) {
+  return {
+    [](get_atom) { return ok_atom_v; },
+    [=](int32_t x) {
+      log->add(name);
+      for (auto& target : targets)
+        self->send(target, x);
+      self->send(sink, ok_atom_v);
+    },
+  };
+}
+
+struct fixture {
+  // Spawns actors A, B, C and D on a single worker, where A sends to D and B
+  // and B sends to C. Returns the order in which the actors ran.
+  std::vector<std::string> run_with_lifo_slot_limit(size_t limit) {
+    actor_system_config cfg;
+    cfg.set("caf.scheduler.policy", "sharing");
+    cfg.set("caf.scheduler.max-threads", 1);
+    cfg.set("caf.scheduler.lifo-slot-limit", limit);
+    actor_system sys{cfg};
+    run_log log;
+    scoped_actor self{sys};
+    auto sink = actor{self};
+    auto c = sys.spawn(recorder, "C", &log, std::vector<actor>{}, sink);
+    auto d = sys.spawn(recorder, "D", &log, std::vector<actor>{}, sink);
+    auto b = sys.spawn(recorder, "B", &log, std::vector<actor>{c}, sink);
+    auto a = sys.spawn(recorder, "A", &log, std::vector<actor>{d, b}, sink);
+    // Make sure all actors are idle before starting.
+    for (auto& hdl : {a, b, c, d})
+      self->request(hdl, infinite, get_atom_v)
+        .receive([](ok_atom) {},
+                 [](const error& err) { CAF_FAIL("ping failed: " << err); });
+    self->send(a, int32_t{42});
+    size_t received = 0;
+    self->receive_for(received, size_t{4})(
+      [](ok_atom) {
+        // nop
+      },
+      after(std::chrono::seconds(10)) >>
+        [] { CAF_FAIL("actors did not run in time"); });
+    for (auto& hdl : {a, b, c, d})
+      self->send_exit(hdl, exit_reason::user_shutdown);
+    return log.entries;
+  }
+};
+
+using strings = std::vector<std::string>;
+
+} // namespace
+
+CAF_TEST_FIXTURE_SCOPE(worker_tests, fixture)
+
+CAF_TEST(without LIFO slot workers run jobs in FIFO order) {
+  CHECK_EQ(run_with_lifo_slot_limit(0), strings({"A", "D", "B", "C"}));
+}
+
+CAF_TEST(the LIFO slot runs the most recently scheduled job next) {
+  CHECK_EQ(run_with_lifo_slot_limit(8), strings({"A", "B", "C", "D"}));
+}
+
+CAF_TEST(the limit bounds consecutive runs from the LIFO slot) {
+  // C enters the slot after B ran from it and thus has to wait for D.
+  CHECK_EQ(run_with_lifo_slot_limit(1), strings({"A", "B", "D", "C"}));
+}
+
+CAF_TEST_FIXTURE_SCOPE_END()
@@ -8,11 +8,14 @@
 
 #include "core-test.hpp"
 
+#include <string>
+#include <vector>
+
 #include "caf/event_based_actor.hpp"
 
 using namespace caf;
 
-using namespace std::string_literals;
+using namespace std::literals;
 
 namespace {
 
@@ -49,6 +52,45 @@ typed_adder(typed_adder_actor::stateful_pointer<counter> self) {
   };
 }
 
+// Counts how many instances of `session` are alive.
+int32_t sessions = 0;
+
+struct session {
+  session() {
+    ++sessions;
+  }
+
+  session(const session&) = delete;
+
+  session& operator=(const session&) = delete;
+
+  ~session() {
+    --sessions;
+  }
+
+  std::string user;
+
+  std::vector<int32_t> history;
+};
+
+template <class Inspector>
+bool inspect(Inspector& f, session& x) {
+  return f.object(x).fields(f.field("user", x.user),
+                            f.field("history", x.history));
+}
+
+behavior hibernating_session(stateful_actor<session>* self) {
+  self->hibernate_after(1s);
+  return {
+    [=](const std::string& user) { self->state.user = user; },
+    [=](int32_t x) { self->state.history.emplace_back(x); },
+    [=](get_atom) {
+      auto& st = self->state;
+      return st.user + ":" + std::to_string(st.history.size());
+    },
+  };
+}
+
 class typed_adder_class : public typed_adder_actor::stateful_impl<counter> {
 public:
   using super = typed_adder_actor::stateful_impl<counter>;
@@ -230,4 +272,72 @@ CAF_TEST(returned behaviors take precedence over make_behavior in the state) {
   expect((int32_t), from(testee).to(self).with(13));
 }
 
+CAF_TEST(idle actors serialize their state while hibernating) {
+  auto aut = sys.spawn(hibernating_session);
+  sched.run();
+  inject((std::string), from(self).to(aut).with("alice"s));
+  inject((int32_t), from(self).to(aut).with(1));
+  inject((int32_t), from(self).to(aut).with(2));
+  auto& ref = deref<stateful_actor<session>>(aut);
+  CHECK(!ref.hibernating());
+  CHECK_EQ(sessions, 1);
+  advance_time(1s);
+  sched.run();
+  CHECK(ref.hibernating());
+  CHECK_EQ(sessions, 0);
+  inject((get_atom), from(self).to(aut).with(get_atom_v));
+  expect((std::string), from(aut).to(self).with("alice:2"s));
+  CHECK(!ref.hibernating());
+  CHECK_EQ(sessions, 1);
+  inject((exit_msg),
+         to(aut).with(exit_msg{aut.address(), exit_reason::kill}));
+  CHECK_EQ(sessions, 0);
+}
+
+CAF_TEST(new messages restart the hibernation timer) {
+  auto aut = sys.spawn(hibernating_session);
+  sched.run();
+  inject((int32_t), from(self).to(aut).with(1));
+  auto& ref = deref<stateful_actor<session>>(aut);
+  advance_time(500ms);
+  inject((int32_t), from(self).to(aut).with(2));
+  advance_time(500ms);
+  sched.run();
+  CHECK(!ref.hibernating());
+  advance_time(500ms);
+  sched.run();
+  CHECK(ref.hibernating());
+  inject((get_atom), from(self).to(aut).with(get_atom_v));
+  expect((std::string), from(aut).to(self).with(":2"s));
+}
+
+CAF_TEST(actors keep states without inspect overload while hibernating) {
+  auto aut = sys.spawn([](stateful_actor<counter>* self) {
+    self->hibernate_after(1s);
+    return adder(self);
+  });
+  sched.run();
+  inject((add_atom, int), from(self).to(aut).with(add_atom_v, 7));
+  auto& ref = deref<stateful_actor<counter>>(aut);
+  advance_time(1s);
+  sched.run();
+  CHECK(ref.hibernating());
+  inject((get_atom), from(self).to(aut).with(get_atom_v));
+  expect((int), from(aut).to(self).with(7));
+}
+
+CAF_TEST(unreachable hibernating actors destroy their state only once) {
+  auto aut = sys.spawn(hibernating_session);
+  sched.run();
+  inject((std::string), from(self).to(aut).with("bob"s));
+  advance_time(1s);
+  sched.run();
+  CHECK(deref<stateful_actor<session>>(aut).hibernating());
+  CHECK_EQ(sessions, 0);
+  auto addr = aut.address();
+  aut = nullptr;
+  CHECK_EQ(actor_cast<actor>(addr), nullptr);
+  CHECK_EQ(sessions, 0);
+}
+
 CAF_TEST_FIXTURE_SCOPE_END()
@@ -13,6 +13,7 @@
 #include "caf/fwd.hpp"
 #include "caf/io/broker.hpp"
 #include "caf/telemetry/collector/prometheus.hpp"
+#include "caf/telemetry/importer/memory_pool.hpp"
 #include "caf/telemetry/importer/process.hpp"
 
 namespace caf::detail {
@@ -41,6 +42,7 @@ private:
   telemetry::collector::prometheus collector_;
   time_t last_scrape_ = 0;
   telemetry::importer::process proc_importer_;
+  telemetry::importer::memory_pool pool_importer_;
 };
 
 } // namespace caf::detail
@@ -34,7 +34,9 @@ constexpr string_view request_ok = "HTTP/1.1 200 OK\r\n"
 } // namespace
 
 prometheus_broker::prometheus_broker(actor_config& cfg)
-  : io::broker(cfg), proc_importer_(system().metrics()) {
+  : io::broker(cfg),
+    proc_importer_(system().metrics()),
+    pool_importer_(system().metrics()) {
   // nop
 }
 
@@ -116,6 +118,8 @@ void prometheus_broker::scrape() {
     last_scrape_ = now;
     proc_importer_.update();
   }
+  // Pool statistics are cheap to read, so we always update them.
+  pool_importer_.update();
 }
 
 } // namespace caf::detail
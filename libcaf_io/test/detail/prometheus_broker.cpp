@@ -71,6 +71,8 @@ CAF_TEST(the prometheus broker responds to HTTP get requests) {
                        response_buf.size()};
   CAF_CHECK(starts_with(response, http_ok_header));
   CAF_CHECK(contains(response, "\ncaf_system_running_actors 2 "));
+  CAF_CHECK(contains(response, "\ncaf_memory_pool_hits_total "));
+  CAF_CHECK(contains(response, "\ncaf_memory_pool_misses_total "));
   if (detail::prometheus_broker::has_process_metrics()) {
     CAF_CHECK(contains(response, "\nprocess_cpu_seconds_total "));
     CAF_CHECK(contains(response, "\nprocess_resident_memory_bytes "));